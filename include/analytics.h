@@ -2,7 +2,16 @@
 #define ANALYTICS_H
 
 #include "market_tick.h"
+#include "quantile_sketch.h"
+#include "tick_batch.h"
+#include "simd_kernels.h"
+#include "rolling_extrema.h"
 #include <deque>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+#include <cmath>
+#include <utility>
 #include <cstdint>
 
 namespace market {
@@ -29,6 +38,16 @@ public:
         total_volume_ += tick.volume;
     }
     
+    /**
+     * @brief Add precomputed batch sums
+     * @param price_volume Σ(price * volume) for the batch
+     * @param volume Σ(volume) for the batch
+     */
+    void addSums(double price_volume, int64_t volume) {
+        total_price_volume_ += price_volume;
+        total_volume_ += volume;
+    }
+    
     /**
      * @brief Get current VWAP
      * @return double VWAP value, 0.0 if no volume
@@ -76,6 +95,14 @@ public:
         }
     }
     
+    /**
+     * @brief Add precomputed batch buy/sell volumes
+     */
+    void addVolumes(int64_t buy_volume, int64_t sell_volume) {
+        buy_volume_ += buy_volume;
+        sell_volume_ += sell_volume;
+    }
+    
     /**
      * @brief Get trade imbalance
      * @return int64_t Buy volume - Sell volume (positive = buy pressure)
@@ -105,20 +132,36 @@ public:
 
 /**
  * @brief Calculates rolling average price over N ticks
+ *
+ * @tparam Allocator Allocator for the window's std::deque; see
+ *         RollingAverageCalculator and pmr::RollingAverageCalculator
  */
-class RollingAverageCalculator {
+template<typename Allocator = std::allocator<double>>
+class BasicRollingAverageCalculator {
 private:
-    std::deque<double> prices_;
+    std::deque<double, Allocator> prices_;
     size_t window_size_;
     double sum_;
     
+    /**
+     * @brief Replace the window with the last window_size prices of a batch at least that long
+     */
+    void fillWindow(const double* prices, size_t count, const simd::KernelTable& k) {
+        const double* tail = prices + (count - window_size_);
+        prices_.assign(tail, tail + window_size_);
+        sum_ = k.sum(tail, window_size_);
+    }
+    
 public:
+    using allocator_type = Allocator;
+
     /**
      * @brief Constructor
      * @param window_size Number of ticks to average over
+     * @param alloc Allocator for the price window
      */
-    RollingAverageCalculator(size_t window_size = 100) 
-        : window_size_(window_size), sum_(0.0) {}
+    BasicRollingAverageCalculator(size_t window_size = 100, const Allocator& alloc = Allocator())
+        : prices_(alloc), window_size_(window_size), sum_(0.0) {}
     
     /**
      * @brief Add a tick to rolling average
@@ -135,6 +178,50 @@ public:
         }
     }
     
+    /**
+     * @brief Add a contiguous batch of prices
+     *
+     * The window sum is recomputed with the vectorized sum kernel, so it may
+     * differ from the per-tick running sum in the last few ulps.
+     *
+     * @param prices Prices in arrival order
+     * @param count Number of prices
+     * @param k Kernel implementation used for the sums
+     */
+    void addBatch(const double* prices, size_t count,
+                  const simd::KernelTable& k = simd::kernels()) {
+        if (count >= window_size_) {
+            fillWindow(prices, count, k);
+            return;
+        }
+        addBatch(prices, count, k.sum(prices, count), k);
+    }
+    
+    /**
+     * @brief Add a batch whose price sum is already known (simd::BatchSums::price_sum)
+     *
+     * Saves a second pass over the batch when the caller ran a fused kernel.
+     *
+     * @param price_sum Σ(prices[0..count)), summed by kernel k
+     */
+    void addBatch(const double* prices, size_t count, double price_sum,
+                  const simd::KernelTable& k = simd::kernels()) {
+        if (count >= window_size_) {
+            fillWindow(prices, count, k);
+            return;
+        }
+        
+        size_t overflow = prices_.size() + count > window_size_
+            ? prices_.size() + count - window_size_ : 0;
+        double evicted = 0.0;
+        for (size_t i = 0; i < overflow; i++) {
+            evicted += prices_.front();
+            prices_.pop_front();
+        }
+        prices_.insert(prices_.end(), prices, prices + count);
+        sum_ += price_sum - evicted;
+    }
+    
     /**
      * @brief Get current rolling average
      * @return double Average price, 0.0 if no data
@@ -158,23 +245,802 @@ public:
     }
 };
 
+using RollingAverageCalculator = BasicRollingAverageCalculator<>;
+
+namespace pmr {
+
+/**
+ * @brief Rolling average whose window draws from a std::pmr::memory_resource
+ */
+using RollingAverageCalculator = BasicRollingAverageCalculator<std::pmr::polymorphic_allocator<double>>;
+
+} // namespace pmr
+
+/**
+ * @brief Exponentially weighted moving average and variance of price
+ *
+ * Uses the incremental form (West 1979):
+ *   diff = x - mean; mean += alpha * diff; var = (1 - alpha) * (var + alpha * diff^2)
+ * which stays numerically stable without storing any history.
+ */
+class EWMACalculator {
+private:
+    double alpha_;
+    double mean_;
+    double variance_;
+    bool initialized_;
+    
+public:
+    /**
+     * @brief Constructor
+     * @param alpha Smoothing factor in (0, 1]; larger reacts faster
+     */
+    EWMACalculator(double alpha = 0.05)
+        : alpha_(alpha), mean_(0.0), variance_(0.0), initialized_(false) {}
+    
+    /**
+     * @brief Add a tick to the EWMA
+     * @param tick Market tick to process
+     */
+    void addTick(const MarketTick& tick) { addPrice(tick.price); }
+    
+    /**
+     * @brief Add a single price to the EWMA
+     */
+    void addPrice(double price) {
+        if (!initialized_) {
+            mean_ = price;
+            initialized_ = true;
+            return;
+        }
+        double diff = price - mean_;
+        double increment = alpha_ * diff;
+        mean_ += increment;
+        variance_ = (1.0 - alpha_) * (variance_ + diff * increment);
+    }
+    
+    /**
+     * @brief Get EWMA price, 0.0 if no data
+     */
+    double getMean() const { return mean_; }
+    
+    /**
+     * @brief Get EWMA variance of price
+     */
+    double getVariance() const { return variance_; }
+    
+    /**
+     * @brief Get EWMA standard deviation (volatility) of price
+     */
+    double getStdDev() const { return std::sqrt(variance_); }
+    
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        mean_ = 0.0;
+        variance_ = 0.0;
+        initialized_ = false;
+    }
+};
+
+/**
+ * @brief Realized variance and volatility from tick-to-tick log returns
+ *
+ * Realized variance = Σ ln(p_t / p_{t-1})^2 since the last reset.
+ */
+class RealizedVolatilityCalculator {
+private:
+    double last_price_;
+    double sum_squared_returns_;
+    size_t return_count_;
+    
+public:
+    RealizedVolatilityCalculator()
+        : last_price_(0.0), sum_squared_returns_(0.0), return_count_(0) {}
+    
+    /**
+     * @brief Add a tick to the realized volatility calculation
+     * @param tick Market tick to process
+     */
+    void addTick(const MarketTick& tick) { addPrice(tick.price); }
+    
+    /**
+     * @brief Add a single price
+     */
+    void addPrice(double price) {
+        if (last_price_ > 0.0 && price > 0.0) {
+            double r = std::log(price / last_price_);
+            sum_squared_returns_ += r * r;
+            return_count_++;
+        }
+        last_price_ = price;
+    }
+    
+    /**
+     * @brief Get realized variance (sum of squared log returns)
+     */
+    double getRealizedVariance() const { return sum_squared_returns_; }
+    
+    /**
+     * @brief Get realized volatility (square root of realized variance)
+     */
+    double getRealizedVolatility() const { return std::sqrt(sum_squared_returns_); }
+    
+    /**
+     * @brief Get per-return volatility, 0.0 if no returns
+     */
+    double getPerTickVolatility() const {
+        if (return_count_ == 0) return 0.0;
+        return std::sqrt(sum_squared_returns_ / return_count_);
+    }
+    
+    /**
+     * @brief Get number of log returns accumulated
+     */
+    size_t getReturnCount() const { return return_count_; }
+    
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        last_price_ = 0.0;
+        sum_squared_returns_ = 0.0;
+        return_count_ = 0;
+    }
+};
+
+/**
+ * @brief Rolling price standard deviation over N ticks (windowed Welford)
+ *
+ * Prices are kept in a ring buffer allocated once in the constructor. When
+ * the window is full the oldest price is replaced in a single step:
+ *   mean' = mean + (x_new - x_old) / n
+ *   M2'   = M2 + (x_new - x_old) * (x_new - mean' + x_old - mean)
+ * which avoids the cancellation of the naive Σx² - n·mean² form. Rounding
+ * still accumulates over millions of replacements, so mean and M2 are
+ * recomputed from the buffer every kResyncWindows full windows (amortised O(1)).
+ */
+class RollingStdDevCalculator {
+private:
+    static constexpr size_t kResyncWindows = 16;
+    
+    std::vector<double> window_;
+    size_t window_size_;
+    size_t head_;       // Next slot to overwrite
+    size_t count_;
+    double mean_;
+    double m2_;         // Σ(x - mean)^2 over the window
+    size_t replacements_;
+    
+    void resync() {
+        double sum = 0.0;
+        for (double x : window_) sum += x;
+        mean_ = sum / count_;
+        m2_ = 0.0;
+        for (double x : window_) m2_ += (x - mean_) * (x - mean_);
+        replacements_ = 0;
+    }
+    
+public:
+    /**
+     * @brief Constructor
+     * @param window_size Number of ticks in the window
+     */
+    RollingStdDevCalculator(size_t window_size = 100)
+        : window_(window_size > 0 ? window_size : 1), window_size_(window_size > 0 ? window_size : 1),
+          head_(0), count_(0), mean_(0.0), m2_(0.0), replacements_(0) {}
+    
+    /**
+     * @brief Add a tick to the rolling standard deviation
+     * @param tick Market tick to process
+     */
+    void addTick(const MarketTick& tick) { addPrice(tick.price); }
+    
+    /**
+     * @brief Add a single price
+     */
+    void addPrice(double price) {
+        if (count_ < window_size_) {
+            count_++;
+            double delta = price - mean_;
+            mean_ += delta / count_;
+            m2_ += delta * (price - mean_);
+        } else {
+            double old_price = window_[head_];
+            double old_mean = mean_;
+            mean_ += (price - old_price) / count_;
+            m2_ += (price - old_price) * (price - mean_ + old_price - old_mean);
+            if (m2_ < 0.0) m2_ = 0.0;
+        }
+        window_[head_] = price;
+        head_ = head_ + 1 == window_size_ ? 0 : head_ + 1;
+        if (count_ == window_size_ && ++replacements_ == kResyncWindows * window_size_) {
+            resync();
+        }
+    }
+    
+    /**
+     * @brief Get rolling mean
+     */
+    double getMean() const { return mean_; }
+    
+    /**
+     * @brief Get rolling sample variance, 0.0 with fewer than two ticks
+     */
+    double getVariance() const {
+        if (count_ < 2) return 0.0;
+        return m2_ / (count_ - 1);
+    }
+    
+    /**
+     * @brief Get rolling sample standard deviation
+     */
+    double getStdDev() const { return std::sqrt(getVariance()); }
+    
+    /**
+     * @brief Get number of ticks in current window
+     */
+    size_t getCount() const { return count_; }
+    
+    /**
+     * @brief Reset calculator (keeps the ring buffer)
+     */
+    void reset() {
+        head_ = 0;
+        count_ = 0;
+        mean_ = 0.0;
+        m2_ = 0.0;
+        replacements_ = 0;
+    }
+};
+
+/**
+ * @brief Approximate rolling price quantiles with bounded memory
+ *
+ * Keeps two t-digests that each cover window_size ticks: the one being
+ * filled and the previous full one. Queries merge both, so estimates cover
+ * the most recent window_size to 2 * window_size ticks without retaining
+ * any individual prices.
+ */
+class RollingQuantileCalculator {
+private:
+    TDigest current_;
+    TDigest previous_;
+    mutable TDigest merged_;
+    mutable bool merged_valid_;
+    size_t window_size_;
+    size_t current_count_;
+    
+public:
+    /**
+     * @brief Constructor
+     * @param window_size Number of ticks per digest generation
+     * @param compression t-digest compression (accuracy vs size)
+     */
+    RollingQuantileCalculator(size_t window_size = 1000, double compression = 100.0)
+        : current_(compression), previous_(compression), merged_(compression),
+          merged_valid_(false), window_size_(window_size), current_count_(0) {}
+    
+    /**
+     * @brief Add a tick to the rolling quantile sketch
+     * @param tick Market tick to process
+     */
+    void addTick(const MarketTick& tick) { addPrice(tick.price); }
+    
+    /**
+     * @brief Add a single price to the rolling quantile sketch
+     */
+    void addPrice(double price) {
+        // Rotate generations once the current digest covers a full window
+        if (current_count_ == window_size_) {
+            std::swap(previous_, current_);
+            current_.reset();
+            current_count_ = 0;
+        }
+        current_.add(price);
+        current_count_++;
+        merged_valid_ = false;
+    }
+    
+    /**
+     * @brief Get estimated price at a quantile
+     * @param q Quantile (0.0 to 1.0)
+     * @return double Estimated price, 0.0 if no data
+     */
+    double getQuantile(double q) const {
+        if (!merged_valid_) {
+            merged_.reset();
+            merged_.merge(previous_);
+            merged_.merge(current_);
+            merged_valid_ = true;
+        }
+        return merged_.quantile(q);
+    }
+    
+    /**
+     * @brief Get number of ticks covered by the estimate
+     */
+    size_t getCount() const { return previous_.getCount() + current_.getCount(); }
+    
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        current_.reset();
+        previous_.reset();
+        merged_.reset();
+        merged_valid_ = false;
+        current_count_ = 0;
+    }
+};
+
+/**
+ * @brief Tracks the prevailing quote: mid, quoted spread and microprice
+ *
+ * Microprice = (bid · ask_size + ask · bid_size) / (bid_size + ask_size),
+ * the mid pulled toward the side with less size, which is the side more
+ * likely to be taken out next. The average quoted spread weights each
+ * quote by how long it was in force.
+ */
+class MicropriceCalculator {
+private:
+    double bid_;
+    double ask_;
+    int bid_size_;
+    int ask_size_;
+    uint64_t last_timestamp_ns_;
+    double spread_time_sum_;     // Σ(spread · ns in force)
+    uint64_t time_sum_ns_;
+    size_t quote_count_;
+    
+public:
+    MicropriceCalculator()
+        : bid_(0.0), ask_(0.0), bid_size_(0), ask_size_(0), last_timestamp_ns_(0),
+          spread_time_sum_(0.0), time_sum_ns_(0), quote_count_(0) {}
+    
+    /**
+     * @brief Replace the prevailing quote
+     * @param quote Top-of-book update
+     */
+    void addQuote(const MarketQuote& quote) {
+        if (quote_count_ > 0 && quote.timestamp_ns > last_timestamp_ns_) {
+            uint64_t dt = quote.timestamp_ns - last_timestamp_ns_;
+            spread_time_sum_ += (ask_ - bid_) * static_cast<double>(dt);
+            time_sum_ns_ += dt;
+        }
+        bid_ = quote.bid_price;
+        ask_ = quote.ask_price;
+        bid_size_ = quote.bid_size;
+        ask_size_ = quote.ask_size;
+        last_timestamp_ns_ = quote.timestamp_ns;
+        quote_count_++;
+    }
+    
+    /**
+     * @brief Whether a two-sided quote is in force
+     */
+    bool hasQuote() const { return bid_ > 0.0 && ask_ > 0.0; }
+    
+    /**
+     * @brief Get mid price, 0.0 if no two-sided quote
+     */
+    double getMid() const { return hasQuote() ? 0.5 * (bid_ + ask_) : 0.0; }
+    
+    /**
+     * @brief Get current quoted spread (ask - bid), 0.0 if no two-sided quote
+     */
+    double getSpread() const { return hasQuote() ? ask_ - bid_ : 0.0; }
+    
+    /**
+     * @brief Get size-weighted microprice; the mid if both sizes are zero
+     */
+    double getMicroprice() const {
+        if (!hasQuote()) return 0.0;
+        int64_t total = static_cast<int64_t>(bid_size_) + ask_size_;
+        if (total <= 0) return getMid();
+        return (bid_ * ask_size_ + ask_ * bid_size_) / static_cast<double>(total);
+    }
+    
+    /**
+     * @brief Get time-weighted average quoted spread; the current spread until time has passed
+     */
+    double getTimeWeightedSpread() const {
+        if (time_sum_ns_ == 0) return getSpread();
+        return spread_time_sum_ / static_cast<double>(time_sum_ns_);
+    }
+    
+    double getBid() const { return bid_; }
+    double getAsk() const { return ask_; }
+    
+    /**
+     * @brief Get number of quotes processed
+     */
+    size_t getQuoteCount() const { return quote_count_; }
+    
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        bid_ = 0.0;
+        ask_ = 0.0;
+        bid_size_ = 0;
+        ask_size_ = 0;
+        last_timestamp_ns_ = 0;
+        spread_time_sum_ = 0.0;
+        time_sum_ns_ = 0;
+        quote_count_ = 0;
+    }
+};
+
+/**
+ * @brief Order-flow imbalance (OFI) from successive best quotes
+ *
+ * Each quote update contributes (Cont, Kukanov & Stoikov)
+ *   e = 1{b ≥ b'}·q_b − 1{b ≤ b'}·q_b' − 1{a ≤ a'}·q_a + 1{a ≥ a'}·q_a'
+ * where primes are the previous quote: bid size added or a higher bid is
+ * buying pressure, ask size added or a lower ask is selling pressure.
+ * Both the cumulative sum and the sum over the last N updates are kept;
+ * sizes are integers, so the rolling sum is exact with no resync.
+ */
+class OrderFlowImbalanceCalculator {
+private:
+    std::vector<int64_t> window_;
+    size_t window_size_;
+    size_t head_;       // Next slot to overwrite
+    size_t count_;
+    int64_t window_sum_;
+    int64_t cumulative_;
+    double prev_bid_;
+    double prev_ask_;
+    int prev_bid_size_;
+    int prev_ask_size_;
+    bool has_prev_;
+    
+public:
+    /**
+     * @brief Constructor
+     * @param window_size Number of quote updates in the rolling sum
+     */
+    OrderFlowImbalanceCalculator(size_t window_size = 100)
+        : window_(window_size > 0 ? window_size : 1), window_size_(window_size > 0 ? window_size : 1),
+          head_(0), count_(0), window_sum_(0), cumulative_(0), prev_bid_(0.0), prev_ask_(0.0),
+          prev_bid_size_(0), prev_ask_size_(0), has_prev_(false) {}
+    
+    /**
+     * @brief Add a quote update
+     * @return This update's OFI contribution (0 for the first quote)
+     */
+    int64_t addQuote(const MarketQuote& quote) {
+        int64_t e = 0;
+        if (has_prev_) {
+            if (quote.bid_price >= prev_bid_) e += quote.bid_size;
+            if (quote.bid_price <= prev_bid_) e -= prev_bid_size_;
+            if (quote.ask_price <= prev_ask_) e -= quote.ask_size;
+            if (quote.ask_price >= prev_ask_) e += prev_ask_size_;
+            
+            cumulative_ += e;
+            if (count_ == window_size_) {
+                window_sum_ -= window_[head_];
+            } else {
+                count_++;
+            }
+            window_[head_] = e;
+            window_sum_ += e;
+            head_ = head_ + 1 == window_size_ ? 0 : head_ + 1;
+        }
+        prev_bid_ = quote.bid_price;
+        prev_ask_ = quote.ask_price;
+        prev_bid_size_ = quote.bid_size;
+        prev_ask_size_ = quote.ask_size;
+        has_prev_ = true;
+        return e;
+    }
+    
+    /**
+     * @brief Get OFI summed over all updates (positive = buying pressure)
+     */
+    int64_t getOFI() const { return cumulative_; }
+    
+    /**
+     * @brief Get OFI summed over the last window_size updates
+     */
+    int64_t getRollingOFI() const { return window_sum_; }
+    
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        head_ = 0;
+        count_ = 0;
+        window_sum_ = 0;
+        cumulative_ = 0;
+        prev_bid_ = 0.0;
+        prev_ask_ = 0.0;
+        prev_bid_size_ = 0;
+        prev_ask_size_ = 0;
+        has_prev_ = false;
+    }
+};
+
+/**
+ * @brief Lee-Ready trade sign classification
+ *
+ * A trade above the prevailing mid is a buy, below it a sell (quote rule).
+ * Trades at the mid, or with no quote in force, fall back to the tick test:
+ * a trade above the last different trade price is a buy, below it a sell.
+ * Quotes are taken as contemporaneous with trades (no 5-second lag, which
+ * only corrected for reporting delays in older data).
+ */
+class TradeSignClassifier {
+private:
+    double last_price_;
+    int last_tick_sign_;        // Sign of the last non-zero price change
+    int64_t buy_volume_;
+    int64_t sell_volume_;
+    size_t quote_rule_count_;
+    size_t tick_rule_count_;
+    size_t unclassified_count_;
+    size_t compared_count_;     // Trades with a reported side
+    size_t agreed_count_;
+    
+public:
+    TradeSignClassifier()
+        : last_price_(0.0), last_tick_sign_(0), buy_volume_(0), sell_volume_(0), quote_rule_count_(0),
+          tick_rule_count_(0), unclassified_count_(0), compared_count_(0), agreed_count_(0) {}
+    
+    /**
+     * @brief Classify a tick against the prevailing mid
+     * @param mid Mid price in force, 0.0 if none
+     * @return +1 buy, -1 sell, 0 if unclassifiable (first trade at the mid or without quotes)
+     */
+    int addTick(const MarketTick& tick, double mid) { return addTrade(tick.price, tick.volume, tick.side, mid); }
+    
+    /**
+     * @brief Classify a single trade
+     * @param side Reported side ('B'/'S'), used only to track agreement
+     */
+    int addTrade(double price, int64_t volume, char side, double mid) {
+        if (last_price_ > 0.0 && price != last_price_) last_tick_sign_ = price > last_price_ ? 1 : -1;
+        last_price_ = price;
+        
+        int sign;
+        if (mid > 0.0 && price != mid) {
+            sign = price > mid ? 1 : -1;
+            quote_rule_count_++;
+        } else {
+            sign = last_tick_sign_;
+            tick_rule_count_++;
+        }
+        
+        if (sign > 0) {
+            buy_volume_ += volume;
+        } else if (sign < 0) {
+            sell_volume_ += volume;
+        } else {
+            unclassified_count_++;
+            return 0;
+        }
+        if (side == 'B' || side == 'S') {
+            compared_count_++;
+            agreed_count_ += (side == 'B') == (sign > 0);
+        }
+        return sign;
+    }
+    
+    /**
+     * @brief Get classified buy volume - sell volume
+     */
+    int64_t getImbalance() const { return buy_volume_ - sell_volume_; }
+    int64_t getBuyVolume() const { return buy_volume_; }
+    int64_t getSellVolume() const { return sell_volume_; }
+    
+    /**
+     * @brief Get how many trades each rule decided
+     */
+    size_t getQuoteRuleCount() const { return quote_rule_count_; }
+    size_t getTickRuleCount() const { return tick_rule_count_; }
+    size_t getUnclassifiedCount() const { return unclassified_count_; }
+    
+    /**
+     * @brief Get fraction of classified trades whose sign matches the reported side
+     */
+    double getAgreement() const {
+        if (compared_count_ == 0) return 0.0;
+        return static_cast<double>(agreed_count_) / compared_count_;
+    }
+    
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        last_price_ = 0.0;
+        last_tick_sign_ = 0;
+        buy_volume_ = 0;
+        sell_volume_ = 0;
+        quote_rule_count_ = 0;
+        tick_rule_count_ = 0;
+        unclassified_count_ = 0;
+        compared_count_ = 0;
+        agreed_count_ = 0;
+    }
+};
+
+/**
+ * @brief Effective and realized spread of signed trades
+ *
+ * Effective spread = 2·q·(p − m), with q the trade sign and m the mid when
+ * the trade printed. Realized spread = 2·q·(p − m'), with m' the mid
+ * horizon_ns later: what the liquidity provider kept after the price moved.
+ * Price impact = effective − realized. All are volume-weighted averages in
+ * price units.
+ *
+ * Trades wait in a FIFO until an event at or past their horizon arrives;
+ * they are then settled against the mid in force before that event, so
+ * each event costs amortised O(1). Timestamps must not go backwards, and
+ * trades still pending at the end of a stream are not counted.
+ */
+class SpreadCalculator {
+private:
+    struct PendingTrade {
+        uint64_t due_ns;
+        double effective;       // 2·q·(p − m), already computed
+        double signed_price;    // q·p
+        int sign;
+        int64_t volume;
+    };
+    
+    std::deque<PendingTrade> pending_;
+    uint64_t horizon_ns_;
+    double mid_;
+    double effective_sum_;          // Σ(effective · volume), all trades
+    double effective_bps_sum_;      // Σ(effective / m · 1e4 · volume)
+    int64_t effective_volume_;
+    double realized_sum_;           // Σ(realized · volume), settled trades
+    double settled_effective_sum_;  // Σ(effective · volume), settled trades
+    int64_t realized_volume_;
+    
+    void settle(uint64_t now_ns) {
+        while (!pending_.empty() && pending_.front().due_ns <= now_ns) {
+            const PendingTrade& t = pending_.front();
+            double realized = 2.0 * (t.signed_price - t.sign * mid_);
+            realized_sum_ += realized * t.volume;
+            settled_effective_sum_ += t.effective * t.volume;
+            realized_volume_ += t.volume;
+            pending_.pop_front();
+        }
+    }
+    
+public:
+    /**
+     * @brief Constructor
+     * @param horizon_ns Delay after a trade at which the realized spread is measured
+     */
+    SpreadCalculator(uint64_t horizon_ns = 1000000000ULL)
+        : horizon_ns_(horizon_ns), mid_(0.0), effective_sum_(0.0), effective_bps_sum_(0.0),
+          effective_volume_(0), realized_sum_(0.0), settled_effective_sum_(0.0), realized_volume_(0) {}
+    
+    /**
+     * @brief Settle trades due by this quote, then take its mid
+     */
+    void addQuote(const MarketQuote& quote) {
+        settle(quote.timestamp_ns);
+        if (quote.bid_price > 0.0 && quote.ask_price > 0.0) mid_ = 0.5 * (quote.bid_price + quote.ask_price);
+    }
+    
+    /**
+     * @brief Add a classified trade
+     * @param sign Trade sign from TradeSignClassifier; unsigned trades are ignored
+     */
+    void addTrade(double price, int64_t volume, int sign, uint64_t timestamp_ns) {
+        settle(timestamp_ns);
+        if (mid_ <= 0.0 || sign == 0) return;
+        double effective = 2.0 * sign * (price - mid_);
+        effective_sum_ += effective * volume;
+        effective_bps_sum_ += effective / mid_ * 1e4 * volume;
+        effective_volume_ += volume;
+        pending_.push_back(PendingTrade{timestamp_ns + horizon_ns_, effective, sign * price, sign, volume});
+    }
+    
+    /**
+     * @brief Get volume-weighted effective spread, 0.0 if no trades
+     */
+    double getEffectiveSpread() const {
+        if (effective_volume_ == 0) return 0.0;
+        return effective_sum_ / effective_volume_;
+    }
+    
+    /**
+     * @brief Get volume-weighted effective spread in basis points of the mid
+     */
+    double getEffectiveSpreadBps() const {
+        if (effective_volume_ == 0) return 0.0;
+        return effective_bps_sum_ / effective_volume_;
+    }
+    
+    /**
+     * @brief Get volume-weighted realized spread of settled trades, 0.0 if none
+     */
+    double getRealizedSpread() const {
+        if (realized_volume_ == 0) return 0.0;
+        return realized_sum_ / realized_volume_;
+    }
+    
+    /**
+     * @brief Get price impact (effective − realized) over the same settled trades
+     */
+    double getPriceImpact() const {
+        if (realized_volume_ == 0) return 0.0;
+        return (settled_effective_sum_ - realized_sum_) / realized_volume_;
+    }
+    
+    /**
+     * @brief Get number of trades still waiting for their horizon
+     */
+    size_t getPendingCount() const { return pending_.size(); }
+    
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        pending_.clear();
+        mid_ = 0.0;
+        effective_sum_ = 0.0;
+        effective_bps_sum_ = 0.0;
+        effective_volume_ = 0;
+        realized_sum_ = 0.0;
+        settled_effective_sum_ = 0.0;
+        realized_volume_ = 0;
+    }
+};
+
 /**
  * @brief Combined analytics engine
+ *
+ * Trades go through processTick()/processBatch(); quote updates for the
+ * same symbol go through processQuote(), interleaved in arrival order.
+ * Every trade is signed (Lee-Ready) against the quote in force, which also
+ * feeds the effective and realized spreads. All per-event work is O(1).
  */
 class AnalyticsEngine {
 private:
     VWAPCalculator vwap_;
     TradeImbalanceCalculator imbalance_;
     RollingAverageCalculator rolling_avg_;
+    RollingQuantileCalculator price_quantiles_;
+    EWMACalculator ewma_;
+    RealizedVolatilityCalculator realized_vol_;
+    RollingStdDevCalculator rolling_std_;
+    RollingMinMaxCalculator rolling_extrema_;
+    TimeRollingMinMaxCalculator time_extrema_;
+    MicropriceCalculator quote_;
+    OrderFlowImbalanceCalculator ofi_;
+    TradeSignClassifier trade_signs_;
+    SpreadCalculator spreads_;
     size_t tick_count_;
     
+    void classifyTrade(double price, int64_t volume, char side, uint64_t timestamp_ns) {
+        int sign = trade_signs_.addTrade(price, volume, side, quote_.getMid());
+        spreads_.addTrade(price, volume, sign, timestamp_ns);
+    }
+    
 public:
     /**
      * @brief Constructor
-     * @param rolling_window Size of rolling average window
+     * @param rolling_window Size of rolling average, standard deviation and high/low window
+     * @param quantile_window Ticks per generation of the rolling price quantile sketch
+     * @param ewma_alpha Smoothing factor for EWMA price and variance
+     * @param extrema_window_ns Length of the time-based high/low window
+     * @param ofi_window Quote updates in the rolling order-flow imbalance
+     * @param realized_spread_horizon_ns Delay after a trade at which the realized spread is measured
      */
-    AnalyticsEngine(size_t rolling_window = 100)
-        : rolling_avg_(rolling_window), tick_count_(0) {}
+    AnalyticsEngine(size_t rolling_window = 100, size_t quantile_window = 1000, double ewma_alpha = 0.05,
+                    uint64_t extrema_window_ns = 1000000000ULL, size_t ofi_window = 100,
+                    uint64_t realized_spread_horizon_ns = 1000000000ULL)
+        : rolling_avg_(rolling_window), price_quantiles_(quantile_window),
+          ewma_(ewma_alpha), rolling_std_(rolling_window),
+          rolling_extrema_(rolling_window), time_extrema_(extrema_window_ns),
+          ofi_(ofi_window), spreads_(realized_spread_horizon_ns), tick_count_(0) {}
     
     /**
      * @brief Process a tick through all analytics
@@ -184,9 +1050,65 @@ public:
         vwap_.addTick(tick);
         imbalance_.addTick(tick);
         rolling_avg_.addTick(tick);
+        price_quantiles_.addTick(tick);
+        ewma_.addTick(tick);
+        realized_vol_.addTick(tick);
+        rolling_std_.addTick(tick);
+        rolling_extrema_.addTick(tick);
+        time_extrema_.addTick(tick);
+        classifyTrade(tick.price, tick.volume, tick.side, tick.timestamp_ns);
         tick_count_++;
     }
     
+    /**
+     * @brief Process a top-of-book quote update
+     * @param quote Quote for this engine's symbol
+     */
+    void processQuote(const MarketQuote& quote) {
+        spreads_.addQuote(quote);
+        quote_.addQuote(quote);
+        ofi_.addQuote(quote);
+    }
+    
+    /**
+     * @brief Process a structure-of-arrays batch of ticks
+     *
+     * VWAP, buy/sell volume and rolling-window sums come from a single pass of
+     * the best SIMD kernel for this CPU (see simd::kernels()). Volume totals
+     * are exact; price sums match processTick() within the tolerance
+     * documented on simd::KernelTable.
+     *
+     * @param batch Ticks for this engine's symbol, in arrival order
+     */
+    void processBatch(const TickBatch& batch) {
+        processBatch(batch, simd::kernels());
+    }
+    
+    /**
+     * @brief Process a batch with an explicit kernel implementation
+     */
+    void processBatch(const TickBatch& batch, const simd::KernelTable& kernels) {
+        const size_t count = batch.size();
+        if (count == 0) return;
+        
+        simd::BatchSums sums = kernels.batch_sums(batch.prices(), batch.volumes(), batch.sides(), count);
+        vwap_.addSums(sums.price_volume, sums.volume);
+        imbalance_.addVolumes(sums.buy_volume, sums.sell_volume);
+        rolling_avg_.addBatch(batch.prices(), count, sums.price_sum, kernels);
+        // Order-dependent recurrences stay sequential
+        const double* prices = batch.prices();
+        for (size_t i = 0; i < count; i++) {
+            price_quantiles_.addPrice(prices[i]);
+            ewma_.addPrice(prices[i]);
+            realized_vol_.addPrice(prices[i]);
+            rolling_std_.addPrice(prices[i]);
+            rolling_extrema_.addPrice(prices[i]);
+            time_extrema_.addPrice(prices[i], batch.timestamps()[i]);
+            classifyTrade(prices[i], batch.volumes()[i], batch.sides()[i], batch.timestamps()[i]);
+        }
+        tick_count_ += count;
+    }
+    
     /**
      * @brief Get VWAP
      */
@@ -202,6 +1124,41 @@ public:
      */
     double getRollingAverage() const { return rolling_avg_.getAverage(); }
     
+    /**
+     * @brief Get rolling price quantile (e.g. 0.5 for median)
+     */
+    double getPriceQuantile(double q) const { return price_quantiles_.getQuantile(q); }
+    
+    /**
+     * @brief Get EWMA price and EWMA price volatility
+     */
+    double getEWMAPrice() const { return ewma_.getMean(); }
+    double getEWMAVolatility() const { return ewma_.getStdDev(); }
+    
+    /**
+     * @brief Get realized volatility from tick-to-tick log returns
+     */
+    double getRealizedVolatility() const { return realized_vol_.getRealizedVolatility(); }
+    
+    /**
+     * @brief Get rolling price standard deviation
+     */
+    double getRollingStdDev() const { return rolling_std_.getStdDev(); }
+    
+    /**
+     * @brief Get rolling high/low/range over the last rolling_window ticks
+     */
+    double getRollingHigh() const { return rolling_extrema_.getMax(); }
+    double getRollingLow() const { return rolling_extrema_.getMin(); }
+    double getRollingRange() const { return rolling_extrema_.getRange(); }
+    
+    /**
+     * @brief Get high/low/range over the last extrema_window_ns nanoseconds
+     */
+    double getTimeWindowHigh() const { return time_extrema_.getMax(); }
+    double getTimeWindowLow() const { return time_extrema_.getMin(); }
+    double getTimeWindowRange() const { return time_extrema_.getRange(); }
+    
     /**
      * @brief Get total tick count
      */
@@ -213,6 +1170,51 @@ public:
     int64_t getBuyVolume() const { return imbalance_.getBuyVolume(); }
     int64_t getSellVolume() const { return imbalance_.getSellVolume(); }
     
+    /**
+     * @brief Get prevailing mid, quoted spread and microprice (0.0 before the first two-sided quote)
+     */
+    double getMidPrice() const { return quote_.getMid(); }
+    double getQuotedSpread() const { return quote_.getSpread(); }
+    double getMicroprice() const { return quote_.getMicroprice(); }
+    
+    /**
+     * @brief Get time-weighted average quoted spread
+     */
+    double getTimeWeightedSpread() const { return quote_.getTimeWeightedSpread(); }
+    
+    /**
+     * @brief Get order-flow imbalance, cumulative and over the last ofi_window quotes
+     */
+    int64_t getOrderFlowImbalance() const { return ofi_.getOFI(); }
+    int64_t getRollingOrderFlowImbalance() const { return ofi_.getRollingOFI(); }
+    
+    /**
+     * @brief Get buy - sell volume with Lee-Ready signs instead of reported sides
+     */
+    int64_t getClassifiedImbalance() const { return trade_signs_.getImbalance(); }
+    
+    /**
+     * @brief Get fraction of classified trades whose Lee-Ready sign matches the reported side
+     */
+    double getClassificationAgreement() const { return trade_signs_.getAgreement(); }
+    
+    /**
+     * @brief Get volume-weighted effective spread, in price units and in basis points
+     */
+    double getEffectiveSpread() const { return spreads_.getEffectiveSpread(); }
+    double getEffectiveSpreadBps() const { return spreads_.getEffectiveSpreadBps(); }
+    
+    /**
+     * @brief Get volume-weighted realized spread and price impact at the configured horizon
+     */
+    double getRealizedSpread() const { return spreads_.getRealizedSpread(); }
+    double getPriceImpact() const { return spreads_.getPriceImpact(); }
+    
+    /**
+     * @brief Get number of quotes processed
+     */
+    size_t getQuoteCount() const { return quote_.getQuoteCount(); }
+    
     /**
      * @brief Reset all analytics
      */
@@ -220,6 +1222,16 @@ public:
         vwap_.reset();
         imbalance_.reset();
         rolling_avg_.reset();
+        price_quantiles_.reset();
+        ewma_.reset();
+        realized_vol_.reset();
+        rolling_std_.reset();
+        rolling_extrema_.reset();
+        time_extrema_.reset();
+        quote_.reset();
+        ofi_.reset();
+        trade_signs_.reset();
+        spreads_.reset();
         tick_count_ = 0;
     }
 };
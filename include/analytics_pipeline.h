@@ -0,0 +1,107 @@
+#ifndef ANALYTICS_PIPELINE_H
+#define ANALYTICS_PIPELINE_H
+
+#include "market_tick.h"
+#include <cstddef>
+#include <type_traits>
+
+namespace market {
+
+/**
+ * @brief Counts ticks seen by a pipeline
+ */
+class TickCounter {
+private:
+    size_t count_;
+
+public:
+    TickCounter() : count_(0) {}
+
+    /**
+     * @brief Count a tick
+     */
+    void addTick(const MarketTick&) { count_++; }
+
+    /**
+     * @brief Get number of ticks processed
+     */
+    size_t getCount() const { return count_; }
+
+    /**
+     * @brief Reset counter
+     */
+    void reset() { count_ = 0; }
+};
+
+/**
+ * @brief Compile-time composed set of analytics calculators
+ *
+ * Fans each tick out to every calculator in Calcs with a fold expression,
+ * so the calls are resolved (and usually inlined) at compile time with no
+ * virtual dispatch. Calculators are private bases, so stateless ones occupy
+ * no storage (empty-base optimisation). A deployment pays only for the
+ * metrics it lists:
+ *
+ *   AnalyticsPipeline<VWAPCalculator, RollingMinMaxCalculator> pipeline;
+ *   pipeline.processTick(tick);
+ *   double vwap = pipeline.get<VWAPCalculator>().getVWAP();
+ *
+ * Each calculator must provide addTick(const MarketTick&) and reset(), and
+ * each type may appear only once.
+ *
+ * @tparam Calcs Calculator types
+ */
+template<typename... Calcs>
+class AnalyticsPipeline : private Calcs... {
+    static_assert(sizeof...(Calcs) > 0, "AnalyticsPipeline needs at least one calculator");
+
+public:
+    /**
+     * @brief Default-construct every calculator
+     */
+    AnalyticsPipeline() = default;
+
+    /**
+     * @brief Construct from preconfigured calculators (e.g. custom windows)
+     */
+    explicit AnalyticsPipeline(const Calcs&... calcs) : Calcs(calcs)... {}
+
+    /**
+     * @brief Process a tick through all calculators, in template order
+     * @param tick Market tick to process
+     */
+    void processTick(const MarketTick& tick) {
+        (static_cast<Calcs&>(*this).addTick(tick), ...);
+    }
+
+    /**
+     * @brief Access a calculator by type
+     */
+    template<typename Calc>
+    Calc& get() {
+        static_assert((std::is_same<Calc, Calcs>::value || ...), "Calculator not in pipeline");
+        return static_cast<Calc&>(*this);
+    }
+
+    template<typename Calc>
+    const Calc& get() const {
+        static_assert((std::is_same<Calc, Calcs>::value || ...), "Calculator not in pipeline");
+        return static_cast<const Calc&>(*this);
+    }
+
+    /**
+     * @brief Number of calculators in the pipeline
+     */
+    static constexpr size_t size() { return sizeof...(Calcs); }
+
+    /**
+     * @brief Reset all calculators
+     */
+    void reset() {
+        (static_cast<Calcs&>(*this).reset(), ...);
+    }
+};
+
+} // namespace market
+
+#endif // ANALYTICS_PIPELINE_H
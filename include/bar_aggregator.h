@@ -0,0 +1,167 @@
+#ifndef BAR_AGGREGATOR_H
+#define BAR_AGGREGATOR_H
+
+#include "market_tick.h"
+#include "lockfree_queue.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace market {
+
+/**
+ * @brief Open/high/low/close/volume bar for one symbol and interval
+ */
+struct OHLCVBar {
+    std::string symbol;      // Ticker symbol
+    uint64_t interval_ns;    // Bar length in nanoseconds
+    uint64_t start_ns;       // Bucket start, a multiple of interval_ns
+    double open;
+    double high;
+    double low;
+    double close;
+    int64_t volume;          // Σ(volume) over the bar
+    uint32_t trade_count;    // Number of ticks in the bar
+
+    OHLCVBar()
+        : interval_ns(0), start_ns(0), open(0.0), high(0.0), low(0.0),
+          close(0.0), volume(0), trade_count(0) {}
+};
+
+/**
+ * @brief Builds OHLCV bars for several intervals per symbol in one pass
+ *
+ * Each tick is bucketed by timestamp_ns into [k * interval, (k + 1) * interval)
+ * for every configured interval, so bar boundaries are aligned to the epoch
+ * (1s bars start on whole seconds, 1m bars on whole minutes). A bar is
+ * emitted to the output queue when the first tick of a later bucket
+ * arrives; intervals with no ticks produce no bar. Timestamps are assumed
+ * non-decreasing per symbol; a late tick is folded into the open bar.
+ */
+class BarAggregator {
+private:
+    struct OpenBar {
+        uint64_t start_ns;
+        double open;
+        double high;
+        double low;
+        double close;
+        int64_t volume;
+        uint32_t trade_count;
+    };
+
+    std::vector<uint64_t> intervals_ns_;
+    lockfree::SPSCQueue<OHLCVBar>& output_;
+    std::unordered_map<std::string, uint32_t> symbol_index_;
+    std::vector<std::string> symbols_;
+    std::vector<OpenBar> bars_;          // [symbol_index * intervals + interval]
+    size_t bars_emitted_;
+
+    void emit(uint32_t symbol_idx, size_t interval_idx, const OpenBar& bar) {
+        OHLCVBar out;
+        out.symbol = symbols_[symbol_idx];
+        out.interval_ns = intervals_ns_[interval_idx];
+        out.start_ns = bar.start_ns;
+        out.open = bar.open;
+        out.high = bar.high;
+        out.low = bar.low;
+        out.close = bar.close;
+        out.volume = bar.volume;
+        out.trade_count = bar.trade_count;
+        output_.push(out);
+        bars_emitted_++;
+    }
+
+    uint32_t lookupSymbol(const std::string& symbol) {
+        auto it = symbol_index_.find(symbol);
+        if (it != symbol_index_.end()) return it->second;
+
+        uint32_t idx = static_cast<uint32_t>(symbols_.size());
+        symbol_index_.emplace(symbol, idx);
+        symbols_.push_back(symbol);
+        bars_.resize(bars_.size() + intervals_ns_.size(), OpenBar{0, 0.0, 0.0, 0.0, 0.0, 0, 0});
+        return idx;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param intervals_ns Bar lengths in nanoseconds (e.g. 1s, 1m, 5m)
+     * @param output Queue receiving completed bars
+     * @param expected_symbols Number of symbols to reserve state for
+     * @throws std::invalid_argument if any interval is zero
+     */
+    BarAggregator(const std::vector<uint64_t>& intervals_ns,
+                  lockfree::SPSCQueue<OHLCVBar>& output,
+                  size_t expected_symbols = 1024)
+        : intervals_ns_(intervals_ns), output_(output), bars_emitted_(0) {
+        for (uint64_t interval : intervals_ns_) {
+            if (interval == 0) throw std::invalid_argument("BarAggregator: bar interval must be non-zero");
+        }
+        symbol_index_.reserve(expected_symbols);
+        symbols_.reserve(expected_symbols);
+        bars_.reserve(expected_symbols * intervals_ns_.size());
+    }
+
+    /**
+     * @brief Add a tick to every interval's bar for its symbol
+     * @param tick Market tick to process
+     */
+    void addTick(const MarketTick& tick) {
+        uint32_t symbol_idx = lookupSymbol(tick.symbol);
+        OpenBar* bars = &bars_[symbol_idx * intervals_ns_.size()];
+
+        for (size_t i = 0; i < intervals_ns_.size(); i++) {
+            OpenBar& bar = bars[i];
+            uint64_t bucket = tick.timestamp_ns - tick.timestamp_ns % intervals_ns_[i];
+
+            if (bar.trade_count == 0 || bucket > bar.start_ns) {
+                if (bar.trade_count != 0) emit(symbol_idx, i, bar);
+                bar = OpenBar{bucket, tick.price, tick.price, tick.price, tick.price, tick.volume, 1};
+                continue;
+            }
+
+            if (tick.price > bar.high) bar.high = tick.price;
+            if (tick.price < bar.low) bar.low = tick.price;
+            bar.close = tick.price;
+            bar.volume += tick.volume;
+            bar.trade_count++;
+        }
+    }
+
+    /**
+     * @brief Emit every open bar (e.g. at end of session) and clear state
+     */
+    void flush() {
+        for (uint32_t s = 0; s < symbols_.size(); s++) {
+            for (size_t i = 0; i < intervals_ns_.size(); i++) {
+                OpenBar& bar = bars_[s * intervals_ns_.size() + i];
+                if (bar.trade_count != 0) {
+                    emit(s, i, bar);
+                    bar.trade_count = 0;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Get number of bars pushed to the output queue
+     */
+    size_t getBarsEmitted() const { return bars_emitted_; }
+
+    /**
+     * @brief Get number of distinct symbols seen
+     */
+    size_t getSymbolCount() const { return symbols_.size(); }
+
+    /**
+     * @brief Get configured bar intervals
+     */
+    const std::vector<uint64_t>& getIntervals() const { return intervals_ns_; }
+};
+
+} // namespace market
+
+#endif // BAR_AGGREGATOR_H
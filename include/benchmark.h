@@ -2,6 +2,11 @@
 #define BENCHMARK_H
 
 #include "market_tick.h"
+#include "quantile_sketch.h"
+#include "benchmark_config.h"
+#include "perf_counters.h"
+#include "stage_trace.h"
+#include "queue_depth.h"
 #include <vector>
 #include <algorithm>
 #include <numeric>
@@ -90,6 +95,14 @@ public:
      */
     size_t getCount() const { return latencies_micros_.size(); }
     
+    /**
+     * @brief Merge measurements from another tracker (e.g. another consumer)
+     */
+    void merge(const LatencyTracker& other) {
+        latencies_micros_.insert(latencies_micros_.end(),
+                                 other.latencies_micros_.begin(), other.latencies_micros_.end());
+    }
+    
     /**
      * @brief Reset all measurements
      */
@@ -98,6 +111,96 @@ public:
     }
 };
 
+/**
+ * @brief Bounded-memory latency tracker backed by a t-digest
+ *
+ * Drop-in alternative to LatencyTracker: same interface, but percentiles are
+ * estimated from a streaming sketch instead of sorting every sample. Mean,
+ * min and max stay exact.
+ */
+class SketchLatencyTracker {
+private:
+    market::TDigest digest_;
+    double sum_micros_;
+    
+public:
+    /**
+     * @brief Constructor
+     * @param compression t-digest compression (accuracy vs size)
+     */
+    explicit SketchLatencyTracker(double compression = 200.0)
+        : digest_(compression), sum_micros_(0.0) {}
+    
+    /**
+     * @brief Add a latency measurement
+     * @param latency_micros Latency in microseconds
+     */
+    void addLatency(double latency_micros) {
+        digest_.add(latency_micros);
+        sum_micros_ += latency_micros;
+    }
+    
+    /**
+     * @brief Estimate percentile
+     * @param percentile Percentile to calculate (0.0 to 1.0)
+     */
+    double getPercentile(double percentile) const { return digest_.quantile(percentile); }
+    
+    /**
+     * @brief Get P50 (median) latency
+     */
+    double getP50() const { return getPercentile(0.50); }
+    
+    /**
+     * @brief Get P99 latency
+     */
+    double getP99() const { return getPercentile(0.99); }
+    
+    /**
+     * @brief Get P999 latency
+     */
+    double getP999() const { return getPercentile(0.999); }
+    
+    /**
+     * @brief Get mean latency
+     */
+    double getMean() const {
+        size_t count = digest_.getCount();
+        return count == 0 ? 0.0 : sum_micros_ / count;
+    }
+    
+    /**
+     * @brief Get minimum latency (exact)
+     */
+    double getMin() const { return digest_.getMin(); }
+    
+    /**
+     * @brief Get maximum latency (exact)
+     */
+    double getMax() const { return digest_.getMax(); }
+    
+    /**
+     * @brief Get number of samples
+     */
+    size_t getCount() const { return digest_.getCount(); }
+    
+    /**
+     * @brief Merge measurements from another tracker (e.g. another consumer)
+     */
+    void merge(const SketchLatencyTracker& other) {
+        digest_.merge(other.digest_);
+        sum_micros_ += other.sum_micros_;
+    }
+    
+    /**
+     * @brief Reset all measurements
+     */
+    void reset() {
+        digest_.reset();
+        sum_micros_ = 0.0;
+    }
+};
+
 /**
  * @brief Measures throughput (items per second)
  */
@@ -181,6 +284,7 @@ struct BenchmarkResults {
     std::string name;
     size_t ticks_processed;
     double throughput_tps;  // Ticks per second
+    double target_tps = 0.0;  // Offered load for open-loop runs; 0 = closed loop
     double latency_mean;
     double latency_p50;
     double latency_p99;
@@ -188,6 +292,10 @@ struct BenchmarkResults {
     double latency_min;
     double latency_max;
     double elapsed_seconds;
+    PerfSample producer_perf;  // Counters around the producer loop(s), if collected
+    PerfSample consumer_perf;  // Counters around the consumer loop(s), if collected
+    StageBreakdown stages;     // Per-stage histograms of sampled ticks, if traced
+    QueueDepthHistogram queue_depth;  // Depth sampled by producers every kDepthSampleEvery pushes
     
     /**
      * @brief Print results to console
@@ -204,6 +312,22 @@ struct BenchmarkResults {
         std::cout << "  P99:   " << latency_p99 << " μs" << std::endl;
         std::cout << "  P999:  " << latency_p999 << " μs" << std::endl;
         std::cout << "  Max:   " << latency_max << " μs" << std::endl;
+        if (queue_depth.getSamples() > 0) {
+            std::cout << "\nQueue Depth (sampled every " << kDepthSampleEvery << " pushes):" << std::endl;
+            std::cout << "  Mean:  " << queue_depth.getMean() << std::endl;
+            std::cout << "  P50:   " << queue_depth.getPercentile(0.50) << std::endl;
+            std::cout << "  P99:   " << queue_depth.getPercentile(0.99) << std::endl;
+            std::cout << "  Max:   " << queue_depth.getMax() << std::endl;
+        }
+        if (producer_perf.valid() || consumer_perf.valid()) {
+            std::cout << "\nPer-Tick Counters:" << std::endl;
+            printPerfSummary("Producer", producer_perf, ticks_processed);
+            printPerfSummary("Consumer", consumer_perf, ticks_processed);
+        }
+        if (stages.valid()) {
+            std::cout << "\nStage Breakdown:" << std::endl;
+            printStageBreakdown("Pipeline", stages);
+        }
     }
     
     /**
@@ -214,7 +338,7 @@ struct BenchmarkResults {
         if (!file.is_open()) return;
         
         // Header
-        file << "Name,Ticks,Throughput_TPS,Latency_Mean,Latency_P50,Latency_P99,Latency_P999,Latency_Min,Latency_Max,Elapsed_Sec\n";
+        file << "Name,Ticks,Throughput_TPS,Latency_Mean,Latency_P50,Latency_P99,Latency_P999,Latency_Min,Latency_Max,Elapsed_Sec,Target_TPS,Depth_Mean,Depth_P99,Depth_Max\n";
         
         // Data
         for (const auto& r : results) {
@@ -227,7 +351,11 @@ struct BenchmarkResults {
                  << r.latency_p999 << ","
                  << r.latency_min << ","
                  << r.latency_max << ","
-                 << r.elapsed_seconds << "\n";
+                 << r.elapsed_seconds << ","
+                 << r.target_tps << ","
+                 << r.queue_depth.getMean() << ","
+                 << r.queue_depth.getPercentile(0.99) << ","
+                 << r.queue_depth.getMax() << "\n";
         }
         
         file.close();
@@ -239,6 +367,95 @@ struct BenchmarkResults {
  */
 void runComprehensiveBenchmarks();
 
+/**
+ * @brief Run the benchmark matrix described by a command-line config
+ * @return Process exit code: 0 = no regressions (or no baseline given), 2 = regressions,
+ *         1 = baseline could not be loaded or shares no configurations
+ */
+int runConfiguredBenchmarks(const BenchmarkConfig& config);
+
+/**
+ * @brief Compare two saved result files (JSON or CSV)
+ * @return Process exit code: 0 = no regressions, 2 = regressions,
+ *         1 = unreadable file or no configurations in common
+ */
+int runCompare(int argc, char* argv[]);
+
+/**
+ * @brief Compare cross-process shared-memory SPSC against in-process SPSC
+ */
+void runSharedMemoryBenchmarks();
+
+/**
+ * @brief Compare t-digest quantile accuracy and throughput against exact sorting
+ */
+void runQuantileBenchmarks();
+
+/**
+ * @brief Measure per-tick cost of analytics calculators and batch kernels
+ */
+void runAnalyticsBenchmarks();
+
+/**
+ * @brief Measure seqlock snapshot publication with 1-16 reader threads
+ */
+void runSnapshotBenchmarks();
+
+/**
+ * @brief Measure raw tick generation rate for each TickGenerator mode
+ */
+void runGeneratorBenchmarks();
+
+/**
+ * @brief Generate each simulator preset and report its flow characteristics
+ */
+void runSimulatorBenchmarks();
+
+/**
+ * @brief Compare first-pass and steady-state cost of heap vs pre-faulted (huge-page) arena memory
+ */
+void runArenaBenchmarks();
+
+/**
+ * @brief Compare std::allocator, pmr pools, monotonic buffers and the memory arena under runBenchmark
+ */
+void runAllocatorBenchmarks();
+
+/**
+ * @brief Busy-polling ingest from generator, replay file and UDP into SPSC queues
+ */
+void runIngestBenchmarks();
+
+/**
+ * @brief Symbol lookup latency: perfect-hash registry vs dynamic table vs std::unordered_map
+ */
+void runSymbolBenchmarks();
+
+/**
+ * @brief FlatHashMap vs std::unordered_map for symbol state and order-id lookups
+ */
+void runFlatMapBenchmarks();
+
+/**
+ * @brief Quote + trade event rates through AnalyticsEngine and the trade-to-quote calculators
+ */
+void runQuoteBenchmarks();
+
+/**
+ * @brief Sweep open-loop producer rates and report latency vs throughput per queue
+ */
+void runLatencyCurveBenchmarks();
+
+/**
+ * @brief Compare producer/consumer placements: unpinned, same CPU, SMT siblings, same socket, cross socket
+ */
+void runPlacementBenchmarks();
+
+/**
+ * @brief Measure live-telemetry overhead on the hot path and show a scrape
+ */
+void runTelemetryBenchmarks();
+
 } // namespace benchmark
 
 #endif // BENCHMARK_H
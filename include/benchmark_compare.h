@@ -0,0 +1,81 @@
+#ifndef BENCHMARK_COMPARE_H
+#define BENCHMARK_COMPARE_H
+
+#include "benchmark_report.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief Per-run samples of one configuration, keyed by run name
+ */
+struct BaselineSamples {
+    std::vector<double> throughput_tps;
+    std::vector<double> latency_p99;
+};
+
+using BaselineSet = std::map<std::string, BaselineSamples>;
+
+/**
+ * @brief Load per-run results from a JSON (run/queues output) or CSV file
+ *
+ * JSON entries are keyed by "name" (falling back to "queue (ticks)"), CSV
+ * rows by the Name column; repeated CSV names are treated as repetitions.
+ * @return false with error set if the file is missing or malformed
+ */
+bool loadBaseline(const std::string& path, BaselineSet& out, std::string& error);
+
+/**
+ * @brief Collect the per-run samples of freshly measured summaries
+ */
+BaselineSet samplesFromSummaries(const std::vector<BenchmarkSummary>& summaries);
+
+/**
+ * @brief Two-sided p-value of Welch's unequal-variance t-test
+ * @return 1.0 when either side has fewer than two samples
+ */
+double welchTTestPValue(const std::vector<double>& a, const std::vector<double>& b);
+
+/**
+ * @brief Options for flagging regressions
+ */
+struct CompareOptions {
+    double alpha = 0.05;        // Significance level
+    double threshold = 0.05;    // Minimum relative change worth flagging (5%)
+};
+
+/**
+ * @brief Result of a baseline comparison
+ */
+struct CompareOutcome {
+    size_t matched = 0;         // Configurations present on both sides
+    size_t regressions = 0;
+
+    /**
+     * @brief Process exit code: 0 = no regressions, 2 = regressions,
+     *        1 = nothing to compare (no configurations in common)
+     */
+    int exitCode() const {
+        if (matched == 0) return 1;
+        return regressions > 0 ? 2 : 0;
+    }
+};
+
+/**
+ * @brief Compare current results to a baseline and print a table
+ *
+ * A metric is a regression when it moved the wrong way (throughput down,
+ * P99 up) by more than the threshold and Welch's t-test rejects equal means
+ * at alpha. With fewer than two runs on a side no test is possible and the
+ * threshold alone decides; such rows are marked.
+ *
+ * @return Configurations compared and regressions found
+ */
+CompareOutcome compareResults(const BaselineSet& baseline, const BaselineSet& current,
+                              const CompareOptions& options);
+
+} // namespace benchmark
+
+#endif // BENCHMARK_COMPARE_H
@@ -0,0 +1,100 @@
+#ifndef BENCHMARK_CONFIG_H
+#define BENCHMARK_CONFIG_H
+
+#include "telemetry.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief What a consumer does when it finds the queue empty
+ */
+enum class WaitStrategy {
+    Spin,    // Busy-poll (lowest latency, burns the core)
+    Yield,   // std::this_thread::yield()
+    Sleep    // Sleep ~1 µs (frees the core, adds scheduler latency)
+};
+
+/**
+ * @brief Parse "spin" / "yield" / "sleep"
+ * @return false if the name is not recognised
+ */
+bool parseWaitStrategy(const std::string& name, WaitStrategy& out);
+
+/**
+ * @brief Name of a wait strategy, as accepted by parseWaitStrategy()
+ */
+const char* waitStrategyName(WaitStrategy strategy);
+
+/**
+ * @brief Thread layout and load shape for a single benchmark run
+ */
+struct RunOptions {
+    size_t producers = 1;
+    size_t consumers = 1;
+    WaitStrategy wait = WaitStrategy::Yield;
+    double rate_tps = 0.0;          // Total offered load; 0 = closed loop (push flat out)
+    int producer_cpu = -1;          // First producer's CPU, others follow; -1 = unpinned
+    int consumer_cpu = -1;          // First consumer's CPU, others follow; -1 = unpinned
+    int rt_priority = 0;            // SCHED_FIFO priority for all pipeline threads; 0 = default
+    int memory_node = -1;           // NUMA node preferred for producer (queue node) allocations
+    bool perf_counters = false;     // Read perf_event counters around producer/consumer loops
+    uint64_t trace_every = 0;       // Trace 1 in N ticks through each pipeline stage; 0 = off
+    market::TelemetryRegistry* telemetry = nullptr;  // Live counters for an exporter; not owned
+    std::string symbol = "SPY";
+};
+
+/**
+ * @brief Full configuration for the command-line benchmark driver
+ */
+struct BenchmarkConfig {
+    std::vector<std::string> queues = {"lockfree", "mutex"};
+    std::vector<size_t> tick_counts = {100000, 1000000};
+    RunOptions run;
+    size_t warmup = 1;              // Discarded runs before measuring each configuration
+    size_t repetitions = 5;         // Measured runs per configuration
+    std::string json_path = "benchmark_results.json";
+    std::string csv_path;           // Empty = no CSV
+    std::string baseline_path;      // JSON/CSV results to compare against; empty = no comparison
+    double regression_threshold = 0.05;  // Relative change that counts as a regression
+    double significance = 0.05;     // Welch t-test alpha
+    market::TelemetryConfig telemetry;  // Live Prometheus export while running; off unless a path is set
+};
+
+/**
+ * @brief Queue implementations the driver can instantiate
+ */
+const std::vector<std::string>& availableQueues();
+
+/**
+ * @brief Parse command-line options into a config
+ * @param argc Argument count (options only, no program/mode name)
+ * @param argv Option strings
+ * @param config Filled in; starts from defaults
+ * @param error Set to a message when parsing fails
+ * @return false on invalid options or when --help was requested (error empty)
+ */
+bool parseBenchmarkArgs(int argc, char* argv[], BenchmarkConfig& config, std::string& error);
+
+/**
+ * @brief Parse a --threshold value (a non-negative percent) into a fraction
+ * @return false with error set if the value is not a number or is negative
+ */
+bool parseThresholdOption(const std::string& value, double& fraction, std::string& error);
+
+/**
+ * @brief Parse an --alpha value (a significance level strictly between 0 and 1)
+ * @return false with error set if the value is not a number or out of range
+ */
+bool parseAlphaOption(const std::string& value, double& alpha, std::string& error);
+
+/**
+ * @brief Print option help for the driver
+ */
+void printBenchmarkUsage(const char* program);
+
+} // namespace benchmark
+
+#endif // BENCHMARK_CONFIG_H
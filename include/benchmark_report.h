@@ -0,0 +1,237 @@
+#ifndef BENCHMARK_REPORT_H
+#define BENCHMARK_REPORT_H
+
+#include "benchmark.h"
+#include "benchmark_config.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief Two-sided 97.5% Student t quantile for a 95% confidence interval
+ * @param df Degrees of freedom (>= 1)
+ */
+inline double studentT975(size_t df) {
+    static const double table[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+                                   2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+                                   2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    if (df == 0) return 0.0;
+    if (df <= 30) return table[df - 1];
+    return 1.96 + 2.4 / df;   // Within 0.002 of the exact value beyond 30
+}
+
+/**
+ * @brief Summary statistics of one metric across repeated runs
+ */
+struct SampleStats {
+    double mean = 0.0;
+    double stddev = 0.0;    // Sample standard deviation (n - 1)
+    double median = 0.0;
+    double ci95_low = 0.0;  // 95% confidence interval of the mean (t-based)
+    double ci95_high = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    size_t count = 0;
+
+    static SampleStats of(const std::vector<double>& values) {
+        SampleStats s;
+        s.count = values.size();
+        if (values.empty()) return s;
+        s.min = s.max = values[0];
+        double sum = 0.0;
+        for (double v : values) {
+            sum += v;
+            if (v < s.min) s.min = v;
+            if (v > s.max) s.max = v;
+        }
+        s.mean = sum / values.size();
+        if (values.size() > 1) {
+            double sq = 0.0;
+            for (double v : values) sq += (v - s.mean) * (v - s.mean);
+            s.stddev = std::sqrt(sq / (values.size() - 1));
+        }
+
+        std::vector<double> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+        size_t mid = sorted.size() / 2;
+        s.median = sorted.size() % 2 ? sorted[mid] : 0.5 * (sorted[mid - 1] + sorted[mid]);
+
+        double half = studentT975(values.size() - 1) * s.stddev / std::sqrt(static_cast<double>(values.size()));
+        s.ci95_low = s.mean - half;
+        s.ci95_high = s.mean + half;
+        return s;
+    }
+};
+
+/**
+ * @brief One configuration (queue x tick count) aggregated over its repetitions
+ */
+struct BenchmarkSummary {
+    std::string name;       // Run name, e.g. "lockfree (100000)"; key for baseline comparison
+    std::string queue;
+    size_t ticks = 0;
+    std::vector<BenchmarkResults> runs;
+    SampleStats throughput_tps;
+    SampleStats latency_mean;
+    SampleStats latency_p50;
+    SampleStats latency_p99;
+    SampleStats latency_p999;
+    SampleStats latency_max;
+
+    /**
+     * @brief Aggregate measured runs of a configuration
+     */
+    static BenchmarkSummary fromRuns(const std::string& queue, size_t ticks,
+                                     const std::vector<BenchmarkResults>& runs) {
+        BenchmarkSummary s;
+        s.name = runs.empty() ? queue : runs.front().name;
+        s.queue = queue;
+        s.ticks = ticks;
+        s.runs = runs;
+        auto collect = [&runs](double BenchmarkResults::*field) {
+            std::vector<double> values;
+            values.reserve(runs.size());
+            for (const auto& r : runs) values.push_back(r.*field);
+            return SampleStats::of(values);
+        };
+        s.throughput_tps = collect(&BenchmarkResults::throughput_tps);
+        s.latency_mean = collect(&BenchmarkResults::latency_mean);
+        s.latency_p50 = collect(&BenchmarkResults::latency_p50);
+        s.latency_p99 = collect(&BenchmarkResults::latency_p99);
+        s.latency_p999 = collect(&BenchmarkResults::latency_p999);
+        s.latency_max = collect(&BenchmarkResults::latency_max);
+        return s;
+    }
+};
+
+namespace detail {
+
+inline std::string jsonString(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out += buf;
+                } else {
+                    out += c;
+                }
+        }
+    }
+    return out + "\"";
+}
+
+inline std::string jsonNumber(double value) {
+    if (!std::isfinite(value)) return "null";
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.17g", value);
+    return buf;
+}
+
+inline void writePerf(std::ofstream& file, const char* key, const PerfSample& sample) {
+    file << ", " << jsonString(key) << ": {";
+    const char* sep = "";
+    for (int e = 0; e < kPerfEventCount; e++) {
+        if (!sample.has(static_cast<PerfEvent>(e))) continue;
+        file << sep << jsonString(PerfSample::eventName(static_cast<PerfEvent>(e))) << ": "
+             << sample.get(static_cast<PerfEvent>(e));
+        sep = ", ";
+    }
+    file << "}";
+}
+
+inline void writeStats(std::ofstream& file, const char* key, const SampleStats& s, bool last = false) {
+    file << "        " << jsonString(key) << ": {\"mean\": " << jsonNumber(s.mean)
+         << ", \"stddev\": " << jsonNumber(s.stddev)
+         << ", \"median\": " << jsonNumber(s.median)
+         << ", \"ci95_low\": " << jsonNumber(s.ci95_low)
+         << ", \"ci95_high\": " << jsonNumber(s.ci95_high)
+         << ", \"min\": " << jsonNumber(s.min)
+         << ", \"max\": " << jsonNumber(s.max) << "}" << (last ? "\n" : ",\n");
+}
+
+} // namespace detail
+
+/**
+ * @brief Write summaries and the config that produced them as JSON
+ *
+ * Latencies are in microseconds, throughput in ticks per second.
+ * @return false if the file could not be opened
+ */
+inline bool exportToJSON(const std::vector<BenchmarkSummary>& summaries,
+                         const BenchmarkConfig& config, const std::string& filename) {
+    using detail::jsonNumber;
+    using detail::jsonString;
+
+    std::ofstream file(filename);
+    if (!file.is_open()) return false;
+
+    file << "{\n";
+    file << "  \"config\": {\n";
+    file << "    \"producers\": " << config.run.producers << ",\n";
+    file << "    \"consumers\": " << config.run.consumers << ",\n";
+    file << "    \"wait\": " << jsonString(waitStrategyName(config.run.wait)) << ",\n";
+    file << "    \"producer_cpu\": " << config.run.producer_cpu << ",\n";
+    file << "    \"consumer_cpu\": " << config.run.consumer_cpu << ",\n";
+    file << "    \"rt_priority\": " << config.run.rt_priority << ",\n";
+    file << "    \"memory_node\": " << config.run.memory_node << ",\n";
+    file << "    \"perf_counters\": " << (config.run.perf_counters ? "true" : "false") << ",\n";
+    file << "    \"rate_tps\": " << jsonNumber(config.run.rate_tps) << ",\n";
+    file << "    \"symbol\": " << jsonString(config.run.symbol) << ",\n";
+    file << "    \"warmup\": " << config.warmup << ",\n";
+    file << "    \"repetitions\": " << config.repetitions << "\n";
+    file << "  },\n";
+    file << "  \"results\": [\n";
+
+    for (size_t i = 0; i < summaries.size(); i++) {
+        const auto& s = summaries[i];
+        file << "    {\n";
+        file << "      \"name\": " << jsonString(s.name) << ",\n";
+        file << "      \"queue\": " << jsonString(s.queue) << ",\n";
+        file << "      \"ticks\": " << s.ticks << ",\n";
+        file << "      \"repetitions\": " << s.runs.size() << ",\n";
+        file << "      \"stats\": {\n";
+        detail::writeStats(file, "throughput_tps", s.throughput_tps);
+        detail::writeStats(file, "latency_mean_us", s.latency_mean);
+        detail::writeStats(file, "latency_p50_us", s.latency_p50);
+        detail::writeStats(file, "latency_p99_us", s.latency_p99);
+        detail::writeStats(file, "latency_p999_us", s.latency_p999);
+        detail::writeStats(file, "latency_max_us", s.latency_max, true);
+        file << "      },\n";
+        file << "      \"runs\": [\n";
+        for (size_t r = 0; r < s.runs.size(); r++) {
+            const auto& run = s.runs[r];
+            file << "        {\"throughput_tps\": " << jsonNumber(run.throughput_tps)
+                 << ", \"latency_p50_us\": " << jsonNumber(run.latency_p50)
+                 << ", \"latency_p99_us\": " << jsonNumber(run.latency_p99)
+                 << ", \"latency_p999_us\": " << jsonNumber(run.latency_p999)
+                 << ", \"elapsed_seconds\": " << jsonNumber(run.elapsed_seconds)
+                 << ", \"queue_depth_p99\": " << run.queue_depth.getPercentile(0.99)
+                 << ", \"queue_depth_max\": " << run.queue_depth.getMax();
+            if (run.producer_perf.valid()) detail::writePerf(file, "producer_perf", run.producer_perf);
+            if (run.consumer_perf.valid()) detail::writePerf(file, "consumer_perf", run.consumer_perf);
+            file << "}" << (r + 1 < s.runs.size() ? ",\n" : "\n");
+        }
+        file << "      ]\n";
+        file << "    }" << (i + 1 < summaries.size() ? ",\n" : "\n");
+    }
+
+    file << "  ]\n";
+    file << "}\n";
+    return true;
+}
+
+} // namespace benchmark
+
+#endif // BENCHMARK_REPORT_H
@@ -0,0 +1,445 @@
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include "benchmark.h"
+#include "benchmark_config.h"
+#include "thread_placement.h"
+#include "perf_counters.h"
+#include "stage_trace.h"
+#include "telemetry.h"
+#include "queue_depth.h"
+#include "market_tick.h"
+#include "tick_generator.h"
+#include "analytics.h"
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief Generate and push one sampled tick, recording producer-side stage times
+ */
+template<typename QueueType, typename GenerateFn>
+inline void pushTraced(QueueType& queue, StageTracer& tracer, GenerateFn&& generate) {
+    uint32_t id = tracer.begin();
+    uint64_t generate_start = market::getCurrentTimeNanos();
+    market::MarketTick tick = generate();
+    uint64_t generated = market::getCurrentTimeNanos();
+    tick.trace_id = id;
+    queue.push(tick);
+    uint64_t enqueued = market::getCurrentTimeNanos();
+    if (id != 0) {
+        StageTimestamps& slot = tracer.slot(id);
+        slot.generate_start = generate_start;
+        slot.generated = generated;
+        slot.enqueued = enqueued;
+    }
+}
+
+/**
+ * @brief Producer thread function - generates and pushes ticks to queue
+ *
+ * When perf is non-null, hardware/software counters are read around the loop.
+ * When tracer is non-null, one tick in tracer->getSampleEvery() is traced
+ * through each pipeline stage. When telemetry is non-null, pushed ticks are
+ * counted in it. When depth is non-null, queue.size() is sampled into it
+ * every kDepthSampleEvery pushes.
+ */
+template<typename QueueType>
+void producerThread(QueueType& queue, 
+                   size_t num_ticks,
+                   std::atomic<bool>& done,
+                   const std::string& symbol = "SPY",
+                   PerfSample* perf = nullptr,
+                   StageTracer* tracer = nullptr,
+                   market::TelemetrySlot* telemetry = nullptr,
+                   QueueDepthHistogram* depth = nullptr) {
+    market::TickGenerator generator(symbol, 100.0, 0.01, 100, 1000);
+    PerfCounterGroup counters;
+    if (perf && counters.open()) counters.start();
+    
+    uint64_t countdown = tracer ? tracer->getSampleEvery() : 0;
+    for (size_t i = 0; i < num_ticks; i++) {
+        if (tracer && --countdown == 0) {
+            countdown = tracer->getSampleEvery();
+            pushTraced(queue, *tracer, [&generator]() { return generator.generateTick(); });
+        } else {
+            auto tick = generator.generateTick();
+            queue.push(tick);
+        }
+        if (telemetry) telemetry->addProduced();
+        if (depth && (i & (kDepthSampleEvery - 1)) == 0) depth->add(queue.size());
+    }
+    
+    if (perf) *perf = counters.stop();
+    done.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief How closely a paced producer kept to its schedule
+ */
+struct PacingStats {
+    uint64_t late_ticks = 0;      // Sent more than 1 µs after their intended time
+    double max_lag_us = 0.0;      // Worst send delay behind schedule
+};
+
+/**
+ * @brief Open-loop producer - pushes ticks at a fixed rate on a precomputed schedule
+ *
+ * Tick i is due at start + i / rate_tps. Each tick is stamped with its
+ * intended send time rather than the time it was actually pushed, so when
+ * the producer falls behind (queue contention, preemption) the delay still
+ * shows up in the consumer's latency instead of being silently omitted.
+ * A late producer sends immediately and never skips or re-bases the schedule.
+ */
+template<typename QueueType>
+void pacedProducerThread(QueueType& queue,
+                         size_t num_ticks,
+                         double rate_tps,
+                         std::atomic<bool>& done,
+                         PacingStats& pacing,
+                         const std::string& symbol = "SPY",
+                         PerfSample* perf = nullptr,
+                         StageTracer* tracer = nullptr,
+                         market::TelemetrySlot* telemetry = nullptr,
+                         QueueDepthHistogram* depth = nullptr) {
+    market::TickGenerator generator(symbol, 100.0, 0.01, 100, 1000, 42);
+    const double period_ns = 1e9 / rate_tps;
+    const uint64_t start = market::getCurrentTimeNanos() + 1000000;   // 1 ms lead-in
+
+    PerfCounterGroup counters;
+    if (perf && counters.open()) counters.start();
+
+    PacingStats local;
+    uint64_t countdown = tracer ? tracer->getSampleEvery() : 0;
+    for (size_t i = 0; i < num_ticks; i++) {
+        uint64_t intended = start + static_cast<uint64_t>(i * period_ns);
+        uint64_t now = market::getCurrentTimeNanos();
+        while (now < intended) {
+            // Give the core away on long waits so a co-scheduled consumer can run
+            if (intended - now > 50000) std::this_thread::yield();
+            now = market::getCurrentTimeNanos();
+        }
+
+        uint64_t lag_ns = now - intended;
+        if (lag_ns > 1000) local.late_ticks++;
+        if (lag_ns / 1000.0 > local.max_lag_us) local.max_lag_us = lag_ns / 1000.0;
+
+        if (tracer && --countdown == 0) {
+            countdown = tracer->getSampleEvery();
+            pushTraced(queue, *tracer, [&generator, intended]() { return generator.generateTickFast(intended); });
+        } else {
+            queue.push(generator.generateTickFast(intended));
+        }
+        if (telemetry) telemetry->addProduced();
+        if (depth && (i & (kDepthSampleEvery - 1)) == 0) depth->add(queue.size());
+    }
+
+    if (perf) *perf = counters.stop();
+    pacing = local;
+    done.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Consumer thread function - pops ticks, calculates analytics and latency
+ *
+ * When perf is non-null, hardware/software counters are read around the loop.
+ * When tracer is non-null, consumer-side stage times of traced ticks are
+ * recorded (this costs a clock read before every pop). When telemetry is
+ * non-null, each tick's latency, price and volume are counted in it.
+ */
+template<typename QueueType, typename TrackerType = LatencyTracker>
+void consumerThread(QueueType& queue,
+                   std::atomic<bool>& producer_done,
+                   market::AnalyticsEngine& analytics,
+                   TrackerType& latency_tracker,
+                   ThroughputMeter& throughput,
+                   WaitStrategy wait = WaitStrategy::Yield,
+                   PerfSample* perf = nullptr,
+                   StageTracer* tracer = nullptr,
+                   market::TelemetrySlot* telemetry = nullptr) {
+    PerfCounterGroup counters;
+    if (perf && counters.open()) counters.start();
+    throughput.start();
+    
+    while (true) {
+        uint64_t pop_start = tracer ? market::getCurrentTimeNanos() : 0;
+        auto tick_opt = queue.pop();
+        
+        if (tick_opt.has_value()) {
+            auto& tick = tick_opt.value();
+            
+            // Calculate latency
+            uint64_t now = market::getCurrentTimeNanos();
+            double latency_us = market::calculateLatencyMicros(tick.timestamp_ns, now);
+            latency_tracker.addLatency(latency_us);
+            if (telemetry) {
+                telemetry->recordTick(now > tick.timestamp_ns ? now - tick.timestamp_ns : 0,
+                                      tick.price, tick.volume);
+            }
+            
+            // Process analytics
+            analytics.processTick(tick);
+            
+            if (tracer && tick.trace_id != 0) {
+                StageTimestamps& slot = tracer->slot(tick.trace_id);
+                slot.dequeue_start = pop_start;
+                slot.dequeued = now;
+                slot.processed = market::getCurrentTimeNanos();
+            }
+            
+            // Update throughput
+            throughput.addItem();
+        } 
+        else {
+            // Queue is empty, check if producer is done
+            if (producer_done.load(std::memory_order_acquire)) {
+                // Double-check queue is truly empty before exiting
+                if (queue.empty()) {
+                    break;
+                }
+            }
+            switch (wait) {
+                case WaitStrategy::Spin:
+                    break;
+                case WaitStrategy::Yield:
+                    // Brief yield to avoid busy-waiting
+                    std::this_thread::yield();
+                    break;
+                case WaitStrategy::Sleep:
+                    std::this_thread::sleep_for(std::chrono::microseconds(1));
+                    break;
+            }
+        }
+    }
+    
+    throughput.stop();
+    if (perf) *perf = counters.stop();
+}
+
+/**
+ * @brief Run benchmark with specified queue type
+ */
+template<typename QueueType, typename TrackerType = LatencyTracker>
+BenchmarkResults runBenchmark(const std::string& name, size_t num_ticks) {
+    std::cout << "\nRunning benchmark: " << name << " (" << num_ticks << " ticks)" << std::endl;
+    
+    // Create queue and synchronization primitives
+    QueueType queue;
+    std::atomic<bool> producer_done{false};
+    
+    // Create analytics and measurement tools
+    market::AnalyticsEngine analytics(100);
+    TrackerType latency_tracker;
+    ThroughputMeter throughput;
+    PerfSample producer_perf;
+    PerfSample consumer_perf;
+    QueueDepthHistogram depth;
+    
+    // Launch threads
+    std::thread producer(producerThread<QueueType>, std::ref(queue), num_ticks, 
+                        std::ref(producer_done), "SPY", &producer_perf, nullptr, nullptr, &depth);
+    std::thread consumer(consumerThread<QueueType, TrackerType>, std::ref(queue), 
+                        std::ref(producer_done), std::ref(analytics), 
+                        std::ref(latency_tracker), std::ref(throughput), WaitStrategy::Yield,
+                        &consumer_perf, nullptr, nullptr);
+    
+    // Wait for completion
+    producer.join();
+    consumer.join();
+    
+    // Collect results
+    BenchmarkResults results;
+    results.name = name;
+    results.ticks_processed = latency_tracker.getCount();
+    results.throughput_tps = throughput.getThroughput();
+    results.latency_mean = latency_tracker.getMean();
+    results.latency_p50 = latency_tracker.getP50();
+    results.latency_p99 = latency_tracker.getP99();
+    results.latency_p999 = latency_tracker.getP999();
+    results.latency_min = latency_tracker.getMin();
+    results.latency_max = latency_tracker.getMax();
+    results.elapsed_seconds = throughput.getElapsedSeconds();
+    results.producer_perf = producer_perf;
+    results.consumer_perf = consumer_perf;
+    results.queue_depth = depth;
+    
+    std::cout << "  Completed: " << results.ticks_processed << " ticks in " 
+              << results.elapsed_seconds << " seconds" << std::endl;
+    std::cout << "  Throughput: " << static_cast<int>(results.throughput_tps) << " ticks/sec" << std::endl;
+    std::cout << "  Latency P99: " << results.latency_p99 << " μs" << std::endl;
+    printPerfSummary("Producer", producer_perf, num_ticks);
+    printPerfSummary("Consumer", consumer_perf, results.ticks_processed);
+    
+    return results;
+}
+
+/**
+ * @brief Run an open-loop benchmark at a target producer rate
+ *
+ * Latency is measured from each tick's intended send time, so it is
+ * corrected for coordinated omission.
+ */
+template<typename QueueType, typename TrackerType = LatencyTracker>
+BenchmarkResults runRateBenchmark(const std::string& name, size_t num_ticks, double rate_tps,
+                                  PacingStats* pacing_out = nullptr) {
+    QueueType queue;
+    std::atomic<bool> producer_done{false};
+
+    market::AnalyticsEngine analytics(100);
+    TrackerType latency_tracker;
+    ThroughputMeter throughput;
+    PacingStats pacing;
+    QueueDepthHistogram depth;
+
+    std::thread producer(pacedProducerThread<QueueType>, std::ref(queue), num_ticks, rate_tps,
+                         std::ref(producer_done), std::ref(pacing), "SPY", nullptr, nullptr, nullptr,
+                         &depth);
+    std::thread consumer(consumerThread<QueueType, TrackerType>, std::ref(queue),
+                         std::ref(producer_done), std::ref(analytics),
+                         std::ref(latency_tracker), std::ref(throughput), WaitStrategy::Yield,
+                         nullptr, nullptr, nullptr);
+
+    producer.join();
+    consumer.join();
+
+    BenchmarkResults results;
+    results.name = name;
+    results.ticks_processed = latency_tracker.getCount();
+    results.target_tps = rate_tps;
+    results.throughput_tps = throughput.getThroughput();
+    results.latency_mean = latency_tracker.getMean();
+    results.latency_p50 = latency_tracker.getP50();
+    results.latency_p99 = latency_tracker.getP99();
+    results.latency_p999 = latency_tracker.getP999();
+    results.latency_min = latency_tracker.getMin();
+    results.latency_max = latency_tracker.getMax();
+    results.elapsed_seconds = throughput.getElapsedSeconds();
+    results.queue_depth = depth;
+
+    if (pacing_out) *pacing_out = pacing;
+    return results;
+}
+
+/**
+ * @brief Run one benchmark with an explicit thread layout and load shape
+ *
+ * Ticks are split evenly across producers; in open-loop mode each producer
+ * is paced at rate_tps / producers. Producer k runs on producer_cpu + k and
+ * consumer k on consumer_cpu + k when pinning is requested. Consumers keep
+ * separate trackers, merged afterwards; throughput is total ticks over the
+ * longest consumer's active time. Producers additionally prefer
+ * options.memory_node for their allocations, which is where the
+ * linked-list queue's nodes are created. With options.trace_every set, one
+ * tick in N is traced through each stage into results.stages. With
+ * options.telemetry set, every thread reports live counters to its own slot.
+ * Producers sample queue depth into results.queue_depth.
+ */
+template<typename QueueType, typename TrackerType = LatencyTracker>
+BenchmarkResults runConfiguredBenchmark(const std::string& name, size_t num_ticks,
+                                        const RunOptions& options) {
+    QueueType queue;
+    std::atomic<bool> producers_done{false};
+
+    const size_t num_producers = options.producers;
+    const size_t num_consumers = options.consumers;
+    std::vector<market::AnalyticsEngine> analytics(num_consumers);
+    std::vector<TrackerType> trackers(num_consumers);
+    std::vector<ThroughputMeter> meters(num_consumers);
+    std::vector<PacingStats> pacing(num_producers);
+    std::vector<PerfSample> producer_perf(num_producers);
+    std::vector<PerfSample> consumer_perf(num_consumers);
+    std::vector<QueueDepthHistogram> depth(num_producers);
+    std::unique_ptr<StageTracer> tracer;
+    if (options.trace_every > 0) {
+        tracer.reset(new StageTracer(num_ticks, options.trace_every, num_producers));
+    }
+
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < num_producers; p++) {
+        size_t share = num_ticks / num_producers + (p < num_ticks % num_producers ? 1 : 0);
+        producers.emplace_back([&, p, share]() {
+            int cpu = options.producer_cpu < 0 ? -1 : options.producer_cpu + static_cast<int>(p);
+            if (!pinCurrentThread(cpu)) {
+                std::cerr << "Warning: could not pin producer " << p << " to CPU " << cpu << std::endl;
+            }
+            if (!setRealtimePriority(options.rt_priority)) {
+                std::cerr << "Warning: could not set SCHED_FIFO priority " << options.rt_priority << std::endl;
+            }
+            if (!preferMemoryNode(options.memory_node)) {
+                std::cerr << "Warning: could not prefer NUMA node " << options.memory_node << std::endl;
+            }
+            // Each producer signals its own flag; consumers watch the shared one
+            std::atomic<bool> done{false};
+            PerfSample* perf = options.perf_counters ? &producer_perf[p] : nullptr;
+            market::TelemetrySlot* slot = options.telemetry ? options.telemetry->acquire() : nullptr;
+            if (options.rate_tps > 0.0) {
+                pacedProducerThread(queue, share, options.rate_tps / num_producers, done,
+                                    pacing[p], options.symbol, perf, tracer.get(), slot, &depth[p]);
+            } else {
+                producerThread(queue, share, done, options.symbol, perf, tracer.get(), slot, &depth[p]);
+            }
+            if (slot) options.telemetry->release(slot);
+        });
+    }
+
+    std::vector<std::thread> consumers;
+    for (size_t c = 0; c < num_consumers; c++) {
+        consumers.emplace_back([&, c]() {
+            int cpu = options.consumer_cpu < 0 ? -1 : options.consumer_cpu + static_cast<int>(c);
+            if (!pinCurrentThread(cpu)) {
+                std::cerr << "Warning: could not pin consumer " << c << " to CPU " << cpu << std::endl;
+            }
+            if (!setRealtimePriority(options.rt_priority)) {
+                std::cerr << "Warning: could not set SCHED_FIFO priority " << options.rt_priority << std::endl;
+            }
+            market::TelemetrySlot* slot = options.telemetry ? options.telemetry->acquire() : nullptr;
+            consumerThread<QueueType, TrackerType>(queue, producers_done, analytics[c],
+                                                   trackers[c], meters[c], options.wait,
+                                                   options.perf_counters ? &consumer_perf[c] : nullptr,
+                                                   tracer.get(), slot);
+            if (slot) options.telemetry->release(slot);
+        });
+    }
+
+    for (auto& t : producers) t.join();
+    producers_done.store(true, std::memory_order_release);
+    for (auto& t : consumers) t.join();
+
+    TrackerType latency_tracker;
+    size_t processed = 0;
+    double elapsed = 0.0;
+    for (size_t c = 0; c < num_consumers; c++) {
+        latency_tracker.merge(trackers[c]);
+        processed += meters[c].getItemCount();
+        if (meters[c].getElapsedSeconds() > elapsed) elapsed = meters[c].getElapsedSeconds();
+    }
+
+    BenchmarkResults results;
+    for (const auto& perf : producer_perf) results.producer_perf.add(perf);
+    for (const auto& perf : consumer_perf) results.consumer_perf.add(perf);
+    for (const auto& d : depth) results.queue_depth.merge(d);
+    if (tracer) results.stages = tracer->summarize();
+
+    results.name = name;
+    results.ticks_processed = latency_tracker.getCount();
+    results.target_tps = options.rate_tps;
+    results.throughput_tps = elapsed > 0.0 ? processed / elapsed : 0.0;
+    results.latency_mean = latency_tracker.getMean();
+    results.latency_p50 = latency_tracker.getP50();
+    results.latency_p99 = latency_tracker.getP99();
+    results.latency_p999 = latency_tracker.getP999();
+    results.latency_min = latency_tracker.getMin();
+    results.latency_max = latency_tracker.getMax();
+    results.elapsed_seconds = elapsed;
+    return results;
+}
+
+} // namespace benchmark
+
+#endif // BENCHMARK_RUNNER_H
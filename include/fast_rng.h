@@ -0,0 +1,143 @@
+#ifndef FAST_RNG_H
+#define FAST_RNG_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace market {
+
+/**
+ * @brief SplitMix64, used to expand a single seed into generator state
+ */
+inline uint64_t splitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * @brief Map 32 random bits to [0, range) without division or branches
+ *
+ * Lemire's multiply-shift; the bias is at most range / 2^32.
+ */
+inline uint32_t boundedRandom(uint32_t random_bits, uint32_t range) {
+    return static_cast<uint32_t>((static_cast<uint64_t>(random_bits) * range) >> 32);
+}
+
+/**
+ * @brief Map 32 random bits to a double in [0, 1)
+ */
+inline double unitRandom(uint32_t random_bits) {
+    return random_bits * (1.0 / 4294967296.0);
+}
+
+/**
+ * @brief xoshiro256++ pseudo-random generator (Blackman & Vigna)
+ *
+ * 256 bits of state, period 2^256 - 1, a handful of shifts/rotates/adds per
+ * 64-bit output. Not cryptographically secure.
+ */
+class Xoshiro256PlusPlus {
+private:
+    uint64_t s_[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+public:
+    // UniformRandomBitGenerator interface
+    using result_type = uint64_t;
+    static constexpr uint64_t min() { return 0; }
+    static constexpr uint64_t max() { return ~uint64_t(0); }
+
+    /**
+     * @brief Constructor
+     * @param seed Any value; expanded with SplitMix64
+     */
+    explicit Xoshiro256PlusPlus(uint64_t seed = 1) { this->seed(seed); }
+
+    /**
+     * @brief Re-seed the generator
+     */
+    void seed(uint64_t seed) {
+        for (auto& s : s_) s = splitMix64(seed);
+    }
+
+    /**
+     * @brief Next 64 random bits
+     */
+    uint64_t next() {
+        const uint64_t result = rotl(s_[0] + s_[3], 23) + s_[0];
+        const uint64_t t = s_[1] << 17;
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+        s_[2] ^= t;
+        s_[3] = rotl(s_[3], 45);
+        return result;
+    }
+
+    uint64_t operator()() { return next(); }
+
+    /**
+     * @brief Uniform double in [0, 1) from the top 53 bits
+     */
+    double nextDouble() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+};
+
+/**
+ * @brief Several independent xoshiro256++ streams stepped in lockstep
+ *
+ * State is stored lane-major (s0[0..N), s1[0..N), ...) so next() is a
+ * straight-line loop over lanes that the compiler vectorises with AVX2 /
+ * AVX-512. Each lane is seeded from a distinct SplitMix64 output.
+ *
+ * @tparam Lanes Number of parallel streams (8 fills an AVX-512 register)
+ */
+template<size_t Lanes = 8>
+class Xoshiro256PlusPlusLanes {
+private:
+    alignas(64) uint64_t s0_[Lanes];
+    alignas(64) uint64_t s1_[Lanes];
+    alignas(64) uint64_t s2_[Lanes];
+    alignas(64) uint64_t s3_[Lanes];
+
+public:
+    static constexpr size_t kLanes = Lanes;
+
+    explicit Xoshiro256PlusPlusLanes(uint64_t seed = 1) { this->seed(seed); }
+
+    /**
+     * @brief Re-seed all lanes
+     */
+    void seed(uint64_t seed) {
+        for (size_t i = 0; i < Lanes; i++) {
+            s0_[i] = splitMix64(seed);
+            s1_[i] = splitMix64(seed);
+            s2_[i] = splitMix64(seed);
+            s3_[i] = splitMix64(seed);
+        }
+    }
+
+    /**
+     * @brief Write one 64-bit output per lane into out[0..Lanes)
+     */
+    void next(uint64_t* out) {
+        for (size_t i = 0; i < Lanes; i++) {
+            uint64_t sum = s0_[i] + s3_[i];
+            out[i] = ((sum << 23) | (sum >> 41)) + s0_[i];
+            uint64_t t = s1_[i] << 17;
+            s2_[i] ^= s0_[i];
+            s3_[i] ^= s1_[i];
+            s1_[i] ^= s2_[i];
+            s0_[i] ^= s3_[i];
+            s2_[i] ^= t;
+            s3_[i] = (s3_[i] << 45) | (s3_[i] >> 19);
+        }
+    }
+};
+
+} // namespace market
+
+#endif // FAST_RNG_H
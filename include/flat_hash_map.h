@@ -0,0 +1,319 @@
+#ifndef FLAT_HASH_MAP_H
+#define FLAT_HASH_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace market {
+
+/**
+ * @brief Default hash for integer keys (murmur3 fmix64)
+ *
+ * Sequential ids and packed symbols both have weak low bits, so every key
+ * is mixed before use.
+ */
+template<typename Key>
+struct IntegerHash {
+    uint64_t operator()(Key key) const {
+        uint64_t x = static_cast<uint64_t>(key);
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+};
+
+/**
+ * @brief Flat open-addressing hash map for integer keys
+ *
+ * Keys and values live inline in one slot array, so a lookup touches a
+ * control byte group and one slot instead of chasing bucket-list nodes.
+ *
+ * - Robin-hood linear probing: an insert takes the slot of any entry that
+ *   is closer to its home than the new key is, which keeps probe lengths
+ *   short and even.
+ * - Group probing: a parallel array of control bytes holds 7 bits of each
+ *   key's hash (or kEmpty); lookups compare 16 control bytes at once with
+ *   SSE2 and only check keys whose byte matches. The first 15 control
+ *   bytes are mirrored past the end so a group never wraps.
+ * - Backward-shift deletion: erase() pulls the following displaced entries
+ *   back one slot, so there are no tombstones and lookups never slow down
+ *   as entries come and go.
+ * - Capacity is a power of two (at least 16), grown at 3/4 load; reserve()
+ *   sizes the table up front so a known working set never rehashes.
+ *
+ * Pointers returned by find()/tryEmplace() are valid until the next insert
+ * or erase (both may move entries). Not thread-safe.
+ *
+ * @tparam Key Integer key type
+ * @tparam Value Default-constructible, movable mapped type
+ * @tparam Hash 64-bit hash of Key
+ */
+template<typename Key, typename Value, typename Hash = IntegerHash<Key>>
+class FlatHashMap {
+    static_assert(std::is_integral<Key>::value, "FlatHashMap keys must be integers");
+
+public:
+    static constexpr size_t kGroupSize = 16;
+
+private:
+    static constexpr uint8_t kEmpty = 0x80;    // Only control value with the top bit set
+
+    struct Slot {
+        Key key = Key();
+        Value value = Value();
+    };
+
+    std::vector<uint8_t> ctrl_;    // capacity + kGroupSize - 1 bytes (mirrored head)
+    std::vector<Slot> slots_;
+    size_t mask_;
+    size_t size_;
+    Hash hash_;
+
+    static uint8_t fragment(uint64_t hash) { return static_cast<uint8_t>(hash >> 57); }
+
+    size_t home(Key key) const { return static_cast<size_t>(hash_(key)) & mask_; }
+
+    size_t distance(size_t pos) const { return (pos - home(slots_[pos].key)) & mask_; }
+
+    void setCtrl(size_t pos, uint8_t value) {
+        ctrl_[pos] = value;
+        if (pos < kGroupSize - 1) ctrl_[pos + mask_ + 1] = value;
+    }
+
+    /**
+     * @brief Bitmasks of group bytes equal to the fragment, and of empty bytes
+     */
+    void matchGroup(size_t pos, uint8_t h2, uint32_t& match, uint32_t& empty) const {
+        const uint8_t* group = ctrl_.data() + pos;
+#if defined(__SSE2__)
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        __m128i wanted = _mm_set1_epi8(static_cast<char>(h2));
+        match = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, wanted)));
+        empty = static_cast<uint32_t>(_mm_movemask_epi8(bytes));
+#else
+        match = 0;
+        empty = 0;
+        for (size_t i = 0; i < kGroupSize; i++) {
+            match |= static_cast<uint32_t>(group[i] == h2) << i;
+            empty |= static_cast<uint32_t>(group[i] == kEmpty) << i;
+        }
+#endif
+    }
+
+    /**
+     * @brief Slot index of key, or capacity() if absent
+     *
+     * With no tombstones a key always sits before the first empty slot
+     * after its home, so the scan stops at the first group with an empty.
+     */
+    size_t locate(Key key) const {
+        uint64_t h = hash_(key);
+        uint8_t h2 = fragment(h);
+        size_t pos = static_cast<size_t>(h) & mask_;
+        while (true) {
+            uint32_t match, empty;
+            matchGroup(pos, h2, match, empty);
+            if (empty) match &= (empty & (0u - empty)) - 1;    // Only bytes before the first empty
+            while (match) {
+                size_t idx = (pos + static_cast<size_t>(__builtin_ctz(match))) & mask_;
+                if (slots_[idx].key == key) return idx;
+                match &= match - 1;
+            }
+            if (empty) return capacity();
+            pos = (pos + kGroupSize) & mask_;
+        }
+    }
+
+    /**
+     * @brief Robin-hood insert of a key known to be absent; returns where it landed
+     */
+    size_t insertNew(Key key, Value&& value) {
+        uint64_t h = hash_(key);
+        Slot entry{key, std::move(value)};
+        uint8_t entry_ctrl = fragment(h);
+        size_t pos = static_cast<size_t>(h) & mask_;
+        size_t dist = 0;
+        size_t landed = capacity();
+        while (true) {
+            if (ctrl_[pos] == kEmpty) {
+                slots_[pos] = std::move(entry);
+                setCtrl(pos, entry_ctrl);
+                size_++;
+                return landed == capacity() ? pos : landed;
+            }
+            size_t existing = distance(pos);
+            if (existing < dist) {
+                // Take from the rich: the resident is closer to home than we are
+                std::swap(entry, slots_[pos]);
+                uint8_t c = ctrl_[pos];
+                setCtrl(pos, entry_ctrl);
+                entry_ctrl = c;
+                if (landed == capacity()) landed = pos;
+                dist = existing;
+            }
+            pos = (pos + 1) & mask_;
+            dist++;
+        }
+    }
+
+    void rehash(size_t new_capacity) {
+        std::vector<uint8_t> old_ctrl;
+        std::vector<Slot> old_slots;
+        old_ctrl.swap(ctrl_);
+        old_slots.swap(slots_);
+        size_t old_capacity = old_slots.size();
+
+        ctrl_.assign(new_capacity + kGroupSize - 1, kEmpty);
+        slots_.resize(new_capacity);
+        mask_ = new_capacity - 1;
+        size_ = 0;
+        for (size_t i = 0; i < old_capacity; i++) {
+            if (old_ctrl[i] != kEmpty) insertNew(old_slots[i].key, std::move(old_slots[i].value));
+        }
+    }
+
+    static size_t capacityFor(size_t n) {
+        size_t capacity = kGroupSize;
+        while (capacity * 3 / 4 < n) capacity *= 2;
+        return capacity;
+    }
+
+public:
+    /**
+     * @param expected Entries to make room for without rehashing
+     */
+    explicit FlatHashMap(size_t expected = 0) : mask_(0), size_(0) {
+        size_t capacity = capacityFor(expected);
+        ctrl_.assign(capacity + kGroupSize - 1, kEmpty);
+        slots_.resize(capacity);
+        mask_ = capacity - 1;
+    }
+
+    /**
+     * @brief Grow so that n entries fit without a rehash
+     */
+    void reserve(size_t n) {
+        size_t capacity = capacityFor(n);
+        if (capacity > this->capacity()) rehash(capacity);
+    }
+
+    /**
+     * @return Pointer to the value, or nullptr if absent
+     */
+    Value* find(Key key) {
+        size_t idx = locate(key);
+        return idx == capacity() ? nullptr : &slots_[idx].value;
+    }
+
+    const Value* find(Key key) const {
+        size_t idx = locate(key);
+        return idx == capacity() ? nullptr : &slots_[idx].value;
+    }
+
+    bool contains(Key key) const { return locate(key) != capacity(); }
+
+    /**
+     * @brief Insert a default value if absent
+     * @return The value and whether it was inserted
+     */
+    std::pair<Value*, bool> tryEmplace(Key key) {
+        size_t idx = locate(key);
+        if (idx != capacity()) return {&slots_[idx].value, false};
+        if ((size_ + 1) > capacity() * 3 / 4) rehash(capacity() * 2);
+        return {&slots_[insertNew(key, Value())].value, true};
+    }
+
+    /**
+     * @brief Insert or overwrite
+     * @return true if the key was new
+     */
+    bool insert(Key key, Value value) {
+        auto result = tryEmplace(key);
+        *result.first = std::move(value);
+        return result.second;
+    }
+
+    Value& operator[](Key key) { return *tryEmplace(key).first; }
+
+    /**
+     * @brief Remove a key, shifting the following displaced entries back
+     * @return true if the key was present
+     */
+    bool erase(Key key) {
+        size_t idx = locate(key);
+        if (idx == capacity()) return false;
+        size_t next = (idx + 1) & mask_;
+        while (ctrl_[next] != kEmpty && distance(next) != 0) {
+            slots_[idx] = std::move(slots_[next]);
+            setCtrl(idx, ctrl_[next]);
+            idx = next;
+            next = (next + 1) & mask_;
+        }
+        slots_[idx] = Slot();
+        setCtrl(idx, kEmpty);
+        size_--;
+        return true;
+    }
+
+    void clear() {
+        for (size_t i = 0; i < capacity(); i++) {
+            if (ctrl_[i] != kEmpty) slots_[i] = Slot();
+        }
+        std::fill(ctrl_.begin(), ctrl_.end(), kEmpty);
+        size_ = 0;
+    }
+
+    /**
+     * @brief Call f(key, value) for every entry, in slot order
+     */
+    template<typename F>
+    void forEach(F&& f) {
+        for (size_t i = 0; i < capacity(); i++) {
+            if (ctrl_[i] != kEmpty) f(slots_[i].key, slots_[i].value);
+        }
+    }
+
+    template<typename F>
+    void forEach(F&& f) const {
+        for (size_t i = 0; i < capacity(); i++) {
+            if (ctrl_[i] != kEmpty) f(slots_[i].key, slots_[i].value);
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return mask_ + 1; }
+    double loadFactor() const { return static_cast<double>(size_) / capacity(); }
+
+    /**
+     * @brief Mean and max distance of entries from their home slot
+     */
+    void probeStats(double& mean, size_t& max) const {
+        size_t total = 0;
+        max = 0;
+        for (size_t i = 0; i < capacity(); i++) {
+            if (ctrl_[i] == kEmpty) continue;
+            size_t d = distance(i);
+            total += d;
+            if (d > max) max = d;
+        }
+        mean = size_ == 0 ? 0.0 : static_cast<double>(total) / size_;
+    }
+
+    size_t getMemoryBytes() const { return ctrl_.capacity() + slots_.capacity() * sizeof(Slot); }
+};
+
+} // namespace market
+
+#endif // FLAT_HASH_MAP_H
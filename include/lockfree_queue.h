@@ -2,7 +2,10 @@
 #define LOCKFREE_QUEUE_H
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 
 namespace lockfree {
@@ -12,10 +15,22 @@ namespace lockfree {
  * 
  * Uses atomic operations and compare-and-swap for thread-safe
  * lock-free enqueueing and dequeueing of elements.
+ *
+ * Each side also counts its operations on its own cache line, so size()
+ * is two loads instead of a list walk.
+ *
+ * Nodes come from Allocator (rebound to the node type). The producer
+ * allocates and the consumer frees, each through its own copy of the
+ * allocator on its own cache line, so the allocator must accept a
+ * deallocation on one thread concurrent with an allocation on another:
+ * std::allocator, std::pmr::synchronized_pool_resource, or a resource
+ * whose deallocate is a no-op (std::pmr::monotonic_buffer_resource,
+ * market::ArenaResource) while only the producer allocates.
  * 
  * @tparam T Type of elements stored in the queue
+ * @tparam Allocator Allocator for T, rebound to the internal node type
  */
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class SPSCQueue {
 private:
     /**
@@ -27,16 +42,51 @@ private:
         
         Node(const T& value) : data(value), next(nullptr) {}
     };
+
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
     
-    std::atomic<Node*> head_;  // Consumer reads from head
-    std::atomic<Node*> tail_;  // Producer writes to tail
+    // Consumer-owned line
+    alignas(64) std::atomic<Node*> head_;  // Consumer reads from head
+    std::atomic<uint64_t> pop_count_;
+    NodeAllocator consumer_alloc_;         // Frees retired nodes
+
+    // Producer-owned line
+    alignas(64) std::atomic<Node*> tail_;  // Producer writes to tail
+    std::atomic<uint64_t> push_count_;
+    NodeAllocator producer_alloc_;         // Allocates new nodes
+
+    Node* makeNode(const T& value) {
+        Node* node = NodeTraits::allocate(producer_alloc_, 1);
+        try {
+            NodeTraits::construct(producer_alloc_, node, value);
+        } catch (...) {
+            NodeTraits::deallocate(producer_alloc_, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    void destroyNode(Node* node) {
+        NodeTraits::destroy(consumer_alloc_, node);
+        NodeTraits::deallocate(consumer_alloc_, node, 1);
+    }
     
 public:
+    using allocator_type = Allocator;
+
     /**
      * @brief Constructor - initializes with a dummy node
      */
-    SPSCQueue() {
-        Node* dummy = new Node(T{});
+    SPSCQueue() : SPSCQueue(Allocator()) {}
+
+    /**
+     * @brief Constructor with an explicit allocator
+     * @param alloc Allocator copied to both the producer and consumer side
+     */
+    explicit SPSCQueue(const Allocator& alloc)
+        : pop_count_(0), consumer_alloc_(alloc), push_count_(0), producer_alloc_(alloc) {
+        Node* dummy = makeNode(T{});
         head_.store(dummy, std::memory_order_relaxed);
         tail_.store(dummy, std::memory_order_relaxed);
     }
@@ -50,7 +100,7 @@ public:
         
         // Delete the dummy node
         Node* head = head_.load(std::memory_order_relaxed);
-        delete head;
+        destroyNode(head);
     }
     
     // Disable copy and move
@@ -62,15 +112,54 @@ public:
      * @param value Element to push
      */
     void push(const T& value) {
-        Node* new_node = new Node(value);
+        Node* new_node = makeNode(value);
         new_node->next.store(nullptr, std::memory_order_relaxed);
         
+        // Count before publishing, so a pop of this node can never be counted first
+        push_count_.store(push_count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        
         // Get current tail and update it atomically
         Node* old_tail = tail_.load(std::memory_order_acquire);
         old_tail->next.store(new_node, std::memory_order_release);
         tail_.store(new_node, std::memory_order_release);
     }
     
+    /**
+     * @brief Push a batch of elements (called by producer)
+     *
+     * Links the batch privately, then publishes it with one count update and
+     * one store to the old tail, so the consumer sees all or none of it.
+     *
+     * @param values Elements in order
+     * @param count Number of elements
+     */
+    void pushBatch(const T* values, size_t count) {
+        if (count == 0) return;
+        Node* first = makeNode(values[0]);
+        Node* last = first;
+        try {
+            for (size_t i = 1; i < count; i++) {
+                Node* node = makeNode(values[i]);
+                last->next.store(node, std::memory_order_relaxed);
+                last = node;
+            }
+        } catch (...) {
+            // Nothing is published yet; free the partial chain
+            while (first) {
+                Node* next = first->next.load(std::memory_order_relaxed);
+                NodeTraits::destroy(producer_alloc_, first);
+                NodeTraits::deallocate(producer_alloc_, first, 1);
+                first = next;
+            }
+            throw;
+        }
+        
+        push_count_.store(push_count_.load(std::memory_order_relaxed) + count, std::memory_order_release);
+        Node* old_tail = tail_.load(std::memory_order_acquire);
+        old_tail->next.store(first, std::memory_order_release);
+        tail_.store(last, std::memory_order_release);
+    }
+    
     /**
      * @brief Pop an element from the queue (called by consumer)
      * @return std::optional<T> The popped element, or nullopt if queue is empty
@@ -89,9 +178,10 @@ public:
         
         // Move head forward
         head_.store(next, std::memory_order_release);
+        pop_count_.store(pop_count_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
         
         // Delete old head (which was always a dummy node)
-        delete old_head;
+        destroyNode(old_head);
         
         return value;
     }
@@ -105,8 +195,35 @@ public:
         Node* next = head->next.load(std::memory_order_acquire);
         return next == nullptr;
     }
+    
+    /**
+     * @brief Approximate number of queued elements (pushes minus pops)
+     *
+     * Exact when called from either end with the other idle; otherwise it
+     * may include elements the producer is still linking. Never negative:
+     * pushes are counted before their nodes are published, so any pop seen
+     * here was preceded by its push count.
+     */
+    size_t size() const {
+        // Pops first: pushes read afterwards can only be as large or larger
+        uint64_t pops = pop_count_.load(std::memory_order_acquire);
+        uint64_t pushes = push_count_.load(std::memory_order_acquire);
+        return static_cast<size_t>(pushes - pops);
+    }
+
+    allocator_type get_allocator() const { return allocator_type(producer_alloc_); }
 };
 
+namespace pmr {
+
+/**
+ * @brief SPSCQueue drawing nodes from a std::pmr::memory_resource
+ */
+template<typename T>
+using SPSCQueue = lockfree::SPSCQueue<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 } // namespace lockfree
 
 #endif // LOCKFREE_QUEUE_H
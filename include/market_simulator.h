@@ -0,0 +1,154 @@
+#ifndef MARKET_SIMULATOR_H
+#define MARKET_SIMULATOR_H
+
+#include "market_tick.h"
+#include "fast_rng.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace market {
+
+/**
+ * @brief Parameters for a reproducible multi-symbol market simulation
+ *
+ * The same scenario (including seed) always produces the same tick
+ * sequence, so benchmark runs on different builds see identical load.
+ */
+struct SimulatorScenario {
+    std::string name = "custom";
+    uint64_t seed = 42;
+
+    // Symbol universe and mix
+    size_t num_symbols = 100;
+    double zipf_exponent = 1.0;          // Activity of rank k ∝ 1 / k^s (0 = uniform)
+
+    // Prices: geometric Brownian motion per symbol
+    double min_base_price = 10.0;        // Initial prices drawn log-uniformly in [min, max]
+    double max_base_price = 500.0;
+    double annual_drift = 0.05;          // μ
+    double annual_volatility = 0.30;     // σ
+
+    // Arrivals: Hawkes process (Poisson when hawkes_alpha == 0)
+    double base_rate_tps = 100000.0;     // Baseline intensity μ0, ticks per second
+    double hawkes_alpha = 0.0;           // Intensity jump per event, ticks per second
+    double hawkes_beta = 1000.0;         // Excitation decay rate, per second
+    double open_boost = 0.0;             // Extra baseline at t = 0 as a multiple of base rate
+    double open_decay_seconds = 1.0;     // e-folding time of the opening boost
+
+    // Trade size and direction
+    double volume_log_mean = 5.0;        // Lognormal μ of volume (median ≈ e^5 ≈ 148)
+    double volume_log_stddev = 1.0;      // Lognormal σ of volume
+    double buy_probability = 0.5;        // Side skew
+
+    uint64_t start_time_ns = 0;          // Simulated clock origin
+
+    /**
+     * @brief Steady Poisson flow, moderate Zipf skew
+     */
+    static SimulatorScenario steady();
+
+    /**
+     * @brief Market open: decaying baseline boost plus self-exciting bursts
+     */
+    static SimulatorScenario openingBurst();
+
+    /**
+     * @brief Heavy concentration in a few names with persistent buy pressure
+     */
+    static SimulatorScenario skewedMomentum();
+
+    /**
+     * @brief Look up a preset by name ("steady", "open", "skewed")
+     * @return Preset, or steady() for an unknown name
+     */
+    static SimulatorScenario byName(const std::string& name);
+};
+
+/**
+ * @brief Scenario-driven multi-symbol tick simulator
+ *
+ * Events arrive by Ogata thinning of a Hawkes intensity
+ *   λ(t) = μ0 · (1 + boost · e^{-t / τ}) + Σ α · e^{-β (t - t_i)},
+ * each event picks a symbol from a Zipf distribution, advances that
+ * symbol's GBM price over the time since its last trade, and draws a
+ * lognormal volume and a skewed side. Timestamps are simulated time.
+ */
+class MarketSimulator {
+private:
+    SimulatorScenario scenario_;
+    Xoshiro256PlusPlus rng_;
+    std::vector<std::string> symbols_;
+    std::vector<double> zipf_cdf_;
+    std::vector<double> prices_;
+    std::vector<double> last_update_seconds_;
+    double now_seconds_;
+    double excitation_;                  // Σ α e^{-β (t - t_i)} at now_seconds_
+    double drift_per_second_;
+    double volatility_per_sqrt_second_;
+    double cached_normal_;
+    bool has_cached_normal_;
+    uint64_t tick_count_;
+
+    double uniform() { return rng_.nextDouble(); }
+    double exponential(double rate);
+    double normal();
+    double baselineRate(double t) const;
+    double nextArrival();
+    size_t pickSymbol();
+
+public:
+    /**
+     * @brief Constructor
+     * @param scenario Simulation parameters (copied)
+     * @throws std::invalid_argument if the arrival process is ill-defined: base rate
+     *         or excitation decay not positive, or branching ratio α/β outside [0, 1)
+     */
+    explicit MarketSimulator(const SimulatorScenario& scenario);
+
+    /**
+     * @brief Generate the next tick in simulated time
+     */
+    MarketTick nextTick();
+
+    /**
+     * @brief Generate count ticks
+     */
+    std::vector<MarketTick> generateTicks(size_t count);
+
+    /**
+     * @brief Restart from the scenario's seed (replays the same sequence)
+     */
+    void reset();
+
+    /**
+     * @brief Get simulated time of the last tick in nanoseconds
+     */
+    uint64_t getSimulatedTimeNanos() const {
+        return scenario_.start_time_ns + static_cast<uint64_t>(now_seconds_ * 1e9);
+    }
+
+    /**
+     * @brief Get current price of a symbol by Zipf rank (0 = most active)
+     */
+    double getPrice(size_t symbol_idx) const { return prices_[symbol_idx]; }
+
+    /**
+     * @brief Get symbol names, ordered by Zipf rank
+     */
+    const std::vector<std::string>& getSymbols() const { return symbols_; }
+
+    /**
+     * @brief Get the scenario
+     */
+    const SimulatorScenario& getScenario() const { return scenario_; }
+
+    /**
+     * @brief Get number of ticks generated since construction or reset
+     */
+    uint64_t getTickCount() const { return tick_count_; }
+};
+
+} // namespace market
+
+#endif // MARKET_SIMULATOR_H
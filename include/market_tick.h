@@ -4,6 +4,8 @@
 #include <string>
 #include <chrono>
 #include <cstdint>
+#include <cstring>
+#include <type_traits>
 
 namespace market {
 
@@ -18,21 +20,89 @@ struct MarketTick {
     double price;            // Trade price in dollars
     int volume;              // Number of shares traded
     char side;               // 'B' for buy, 'S' for sell
+    uint32_t trace_id;       // Stage-trace slot for sampled ticks; 0 = not traced (fits in padding)
     uint64_t timestamp_ns;   // Nanosecond timestamp for latency tracking
     
     /**
      * @brief Default constructor
      */
     MarketTick() 
-        : symbol(""), price(0.0), volume(0), side('B'), timestamp_ns(0) {}
+        : symbol(""), price(0.0), volume(0), side('B'), trace_id(0), timestamp_ns(0) {}
     
     /**
      * @brief Parameterized constructor
      */
     MarketTick(const std::string& sym, double p, int vol, char s, uint64_t ts)
-        : symbol(sym), price(p), volume(vol), side(s), timestamp_ns(ts) {}
+        : symbol(sym), price(p), volume(vol), side(s), trace_id(0), timestamp_ns(ts) {}
 };
 
+/**
+ * @brief Top-of-book quote update (best bid and offer)
+ *
+ * Each quote replaces the previous one for its symbol; sizes are the
+ * shares resting at the best price on each side.
+ */
+struct MarketQuote {
+    std::string symbol;      // Ticker symbol (e.g., "SPY", "AAPL")
+    double bid_price;        // Best bid in dollars
+    double ask_price;        // Best offer in dollars
+    int bid_size;            // Shares at the best bid
+    int ask_size;            // Shares at the best offer
+    uint64_t timestamp_ns;   // Nanosecond timestamp of the update
+
+    /**
+     * @brief Default constructor
+     */
+    MarketQuote()
+        : symbol(""), bid_price(0.0), ask_price(0.0), bid_size(0), ask_size(0), timestamp_ns(0) {}
+
+    /**
+     * @brief Parameterized constructor
+     */
+    MarketQuote(const std::string& sym, double bid, double ask, int bid_sz, int ask_sz, uint64_t ts)
+        : symbol(sym), bid_price(bid), ask_price(ask), bid_size(bid_sz), ask_size(ask_sz), timestamp_ns(ts) {}
+};
+
+/**
+ * @brief Fixed-size, trivially copyable tick for shared-memory transport
+ *
+ * Mirrors MarketTick but stores the symbol inline (up to 8 chars, not
+ * null-terminated when full) so it can be memcpy'd across process boundaries.
+ */
+struct CompactTick {
+    char symbol[8];          // Inline ticker symbol, zero-padded
+    double price;            // Trade price in dollars
+    int32_t volume;          // Number of shares traded
+    char side;               // 'B' for buy, 'S' for sell
+    uint64_t timestamp_ns;   // Nanosecond timestamp for latency tracking
+
+    /**
+     * @brief Build a compact tick from a MarketTick (symbol truncated to 8 chars)
+     */
+    static CompactTick fromMarketTick(const MarketTick& tick) {
+        CompactTick c{};
+        size_t len = tick.symbol.size() < sizeof(c.symbol) ? tick.symbol.size() : sizeof(c.symbol);
+        std::memcpy(c.symbol, tick.symbol.data(), len);
+        c.price = tick.price;
+        c.volume = tick.volume;
+        c.side = tick.side;
+        c.timestamp_ns = tick.timestamp_ns;
+        return c;
+    }
+
+    /**
+     * @brief Convert back to a MarketTick
+     */
+    MarketTick toMarketTick() const {
+        size_t len = 0;
+        while (len < sizeof(symbol) && symbol[len] != '\0') len++;
+        return MarketTick(std::string(symbol, len), price, volume, side, timestamp_ns);
+    }
+};
+
+static_assert(std::is_trivially_copyable<CompactTick>::value,
+              "CompactTick must be trivially copyable for shared-memory transport");
+
 /**
  * @brief Get current time in nanoseconds since epoch
  * @return uint64_t Nanosecond timestamp
@@ -0,0 +1,147 @@
+#ifndef MEMORY_ARENA_H
+#define MEMORY_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <utility>
+
+namespace market {
+
+/**
+ * @brief How an arena's memory is actually backed
+ */
+enum class ArenaBacking {
+    HugeTLB,           // MAP_HUGETLB: reserved 2MB pages (vm.nr_hugepages)
+    TransparentHuge,   // 2MB-aligned anonymous mapping with MADV_HUGEPAGE
+    Normal             // Ordinary 4KB pages
+};
+
+const char* arenaBackingName(ArenaBacking backing);
+
+/**
+ * @brief How to set up an arena
+ */
+struct ArenaOptions {
+    bool huge_pages = true;     // Try MAP_HUGETLB, then transparent huge pages
+    bool prefault = true;       // Touch every page up front so the hot path never faults
+    bool lock_memory = true;    // mlock() so pages are never reclaimed or swapped
+};
+
+/**
+ * @brief Bump-pointer arena over one anonymous mapping
+ *
+ * Intended for memory set up once at startup: queue ring buffers, symbol
+ * tables and per-symbol analytics state. Huge pages cut TLB misses across
+ * thousands of symbols; pre-faulting and locking move page-fault cost out
+ * of the first pass over the data. Each step falls back rather than fails:
+ * HugeTLB -> transparent huge pages -> normal pages, and a refused mlock()
+ * (RLIMIT_MEMLOCK) is recorded in isLocked().
+ *
+ * Allocation is not thread-safe and memory is only returned by reset() or
+ * destruction. Destructors of created objects are never run, so only put
+ * types there whose destructors need not run (or destroy them yourself).
+ */
+class MemoryArena {
+public:
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+private:
+    char* base_;
+    size_t capacity_;
+    size_t mapped_;        // Length of the mapping (capacity rounded to the page size)
+    size_t offset_;
+    ArenaBacking backing_;
+    bool locked_;
+    bool prefaulted_;
+
+public:
+    /**
+     * @brief Map and prepare an arena
+     * @param capacity Usable bytes (rounded up to the page size)
+     * @param options Huge pages, pre-faulting and locking
+     * @throws std::system_error if no mapping can be created at all
+     */
+    explicit MemoryArena(size_t capacity, const ArenaOptions& options = ArenaOptions());
+    ~MemoryArena();
+
+    // Disable copy and move
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+
+    /**
+     * @brief Allocate raw bytes
+     * @param alignment Power of two
+     * @throws std::bad_alloc if the arena is exhausted
+     */
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t)) {
+        size_t start = (offset_ + alignment - 1) & ~(alignment - 1);
+        if (start + bytes > capacity_ || start + bytes < start) throw std::bad_alloc();
+        offset_ = start + bytes;
+        return base_ + start;
+    }
+
+    /**
+     * @brief Construct one object in the arena
+     */
+    template<typename T, typename... Args>
+    T* create(Args&&... args) {
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Default-construct an array of n objects in the arena
+     */
+    template<typename T>
+    T* createArray(size_t n) {
+        T* p = static_cast<T*>(allocate(sizeof(T) * n, alignof(T)));
+        for (size_t i = 0; i < n; i++) new (p + i) T();
+        return p;
+    }
+
+    /**
+     * @brief Forget all allocations (memory stays mapped, faulted and locked)
+     */
+    void reset() { offset_ = 0; }
+
+    size_t used() const { return offset_; }
+    size_t capacity() const { return capacity_; }
+    ArenaBacking backing() const { return backing_; }
+    bool isLocked() const { return locked_; }
+    bool isPrefaulted() const { return prefaulted_; }
+
+    /**
+     * @brief One-line summary, e.g. "64 MB, transparent huge pages, prefaulted, locked"
+     */
+    std::string describe() const;
+};
+
+/**
+ * @brief std::pmr::memory_resource view of a MemoryArena
+ *
+ * Lets pmr containers and allocator-aware queues (lockfree::pmr::SPSCQueue,
+ * lockfree::pmr::MutexQueue, pmr::RollingAverageCalculator) draw from the
+ * arena, directly or as the upstream of a pool or monotonic resource.
+ * Deallocation is a no-op, so it suits queues where only one thread
+ * allocates; memory comes back only when the arena is reset or destroyed.
+ */
+class ArenaResource : public std::pmr::memory_resource {
+private:
+    MemoryArena& arena_;
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override { return arena_.allocate(bytes, alignment); }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+public:
+    explicit ArenaResource(MemoryArena& arena) : arena_(arena) {}
+
+    MemoryArena& arena() const { return arena_; }
+};
+
+} // namespace market
+
+#endif // MEMORY_ARENA_H
@@ -1,6 +1,9 @@
 #ifndef MUTEX_QUEUE_H
 #define MUTEX_QUEUE_H
 
+#include <deque>
+#include <memory>
+#include <memory_resource>
 #include <queue>
 #include <mutex>
 #include <optional>
@@ -12,17 +15,27 @@ namespace lockfree {
  * 
  * This implementation uses std::queue with std::mutex for thread safety.
  * Used as a baseline to compare against the lock-free queue.
+ * All allocation happens under the mutex, so even an unsynchronized
+ * allocator (std::pmr::unsynchronized_pool_resource) is safe here.
  * 
  * @tparam T Type of elements stored in the queue
+ * @tparam Allocator Allocator for the underlying std::deque
  */
-template<typename T>
+template<typename T, typename Allocator = std::allocator<T>>
 class MutexQueue {
 private:
-    std::queue<T> queue_;
+    std::queue<T, std::deque<T, Allocator>> queue_;
     mutable std::mutex mutex_;
     
 public:
+    using allocator_type = Allocator;
+
     MutexQueue() = default;
+
+    /**
+     * @brief Constructor with an explicit allocator
+     */
+    explicit MutexQueue(const Allocator& alloc) : queue_(alloc) {}
     
     // Disable copy and move
     MutexQueue(const MutexQueue&) = delete;
@@ -37,6 +50,16 @@ public:
         queue_.push(value);
     }
     
+    /**
+     * @brief Push a batch of elements under one lock acquisition
+     * @param values Elements in order
+     * @param count Number of elements
+     */
+    void pushBatch(const T* values, size_t count) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < count; i++) queue_.push(values[i]);
+    }
+    
     /**
      * @brief Pop an element from the queue
      * @return std::optional<T> The popped element, or nullopt if queue is empty
@@ -61,8 +84,26 @@ public:
         std::lock_guard<std::mutex> lock(mutex_);
         return queue_.empty();
     }
+    
+    /**
+     * @brief Number of queued elements
+     */
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+    }
 };
 
+namespace pmr {
+
+/**
+ * @brief MutexQueue drawing storage from a std::pmr::memory_resource
+ */
+template<typename T>
+using MutexQueue = lockfree::MutexQueue<T, std::pmr::polymorphic_allocator<T>>;
+
+} // namespace pmr
+
 } // namespace lockfree
 
 #endif // MUTEX_QUEUE_H
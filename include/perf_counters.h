@@ -0,0 +1,281 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace benchmark {
+
+/**
+ * @brief Events in a PerfCounterGroup, in the order they are opened
+ */
+enum PerfEvent {
+    kPerfCycles = 0,
+    kPerfInstructions,
+    kPerfCacheMisses,
+    kPerfBranchMisses,
+    kPerfLLCMisses,
+    kPerfContextSwitches,
+    kPerfEventCount
+};
+
+/**
+ * @brief Counter values from one thread's measured region
+ *
+ * Events the kernel refused (no PMU in a VM, perf_event_paranoid, ...) or
+ * never scheduled (no free hardware counter) are marked unavailable rather
+ * than reported as zero.
+ */
+struct PerfSample {
+    uint64_t values[kPerfEventCount] = {};
+    bool available[kPerfEventCount] = {};
+    bool multiplexed = false;    // Some counters were scaled for time not scheduled
+
+    bool valid() const {
+        for (bool a : available) if (a) return true;
+        return false;
+    }
+
+    bool has(PerfEvent e) const { return available[e]; }
+    uint64_t get(PerfEvent e) const { return values[e]; }
+
+    /**
+     * @brief Accumulate another thread's sample (events must be available in both)
+     */
+    void add(const PerfSample& other) {
+        bool first = !valid();
+        for (int e = 0; e < kPerfEventCount; e++) {
+            available[e] = first ? other.available[e] : (available[e] && other.available[e]);
+            values[e] += other.values[e];
+        }
+        multiplexed = multiplexed || other.multiplexed;
+    }
+
+    static const char* eventName(PerfEvent e) {
+        switch (e) {
+            case kPerfCycles: return "cycles";
+            case kPerfInstructions: return "instructions";
+            case kPerfCacheMisses: return "cache_misses";
+            case kPerfBranchMisses: return "branch_misses";
+            case kPerfLLCMisses: return "llc_misses";
+            case kPerfContextSwitches: return "context_switches";
+            default: return "unknown";
+        }
+    }
+};
+
+/**
+ * @brief perf_event_open counters for the calling thread
+ *
+ * Opens cycles, instructions, cache misses, branch misses, LLC read misses
+ * and context switches in three groups sized to fit the PMU: {cycles,
+ * instructions, branch misses} and {cache misses, LLC misses} on hardware
+ * counters, and the software context-switch event on its own. Events in a
+ * group are scheduled together, so ratios within a group (IPC) are exact.
+ * The first event that opens in a group becomes its leader; events that
+ * fail to open are skipped. A group the kernel never scheduled (all
+ * counters taken by other perf users or the NMI watchdog) reports its
+ * events unavailable. User space only for hardware events.
+ */
+class PerfCounterGroup {
+private:
+    static constexpr int kGroupCount = 3;
+    static constexpr int kEventGroup[kPerfEventCount] = {0, 0, 1, 0, 1, 2};
+
+    int fds_[kPerfEventCount];
+    uint64_t ids_[kPerfEventCount];
+    int leaders_[kGroupCount];    // Event index of each group's leader, -1 if none opened
+    std::string error_;
+
+    static int openEvent(uint32_t type, uint64_t config, bool exclude_kernel, int group_fd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = group_fd == -1 ? 1 : 0;
+        attr.exclude_kernel = exclude_kernel ? 1 : 0;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID |
+                           PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+
+    /**
+     * @brief Read one group into the sample, scaling for time not scheduled
+     */
+    void readGroup(int leader, PerfSample& sample) const {
+        // { nr, time_enabled, time_running, { value, id }[nr] }
+        uint64_t buffer[3 + 2 * kPerfEventCount];
+        if (::read(fds_[leader], buffer, sizeof(buffer)) < static_cast<ssize_t>(3 * sizeof(uint64_t))) {
+            return;
+        }
+        uint64_t nr = buffer[0];
+        uint64_t enabled = buffer[1];
+        uint64_t running = buffer[2];
+        if (running == 0) return;    // Never scheduled: no data, not zeros
+        double scale = running < enabled ? static_cast<double>(enabled) / running : 1.0;
+        if (running < enabled) sample.multiplexed = true;
+
+        for (uint64_t i = 0; i < nr && i < kPerfEventCount; i++) {
+            uint64_t value = buffer[3 + 2 * i];
+            uint64_t id = buffer[4 + 2 * i];
+            for (int e = 0; e < kPerfEventCount; e++) {
+                if (fds_[e] >= 0 && ids_[e] == id) {
+                    sample.values[e] = static_cast<uint64_t>(value * scale);
+                    sample.available[e] = true;
+                }
+            }
+        }
+    }
+
+public:
+    PerfCounterGroup() {
+        for (int e = 0; e < kPerfEventCount; e++) {
+            fds_[e] = -1;
+            ids_[e] = 0;
+        }
+        for (int g = 0; g < kGroupCount; g++) leaders_[g] = -1;
+    }
+
+    ~PerfCounterGroup() { close(); }
+
+    // Disable copy and move
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+    /**
+     * @brief Open the groups for the calling thread
+     * @return false if no event could be opened (see getError())
+     */
+    bool open() {
+        close();
+        struct EventSpec { uint32_t type; uint64_t config; bool exclude_kernel; };
+        const EventSpec specs[kPerfEventCount] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, true},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, true},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, true},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, true},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                     (PERF_COUNT_HW_CACHE_RESULT_MISS << 16), true},
+            // Switches happen in the kernel; fall back to user-only if that is refused
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, false},
+        };
+
+        int first_errno = 0;
+        for (int e = 0; e < kPerfEventCount; e++) {
+            int& leader = leaders_[kEventGroup[e]];
+            int group_fd = leader < 0 ? -1 : fds_[leader];
+            int fd = openEvent(specs[e].type, specs[e].config, specs[e].exclude_kernel, group_fd);
+            if (fd < 0 && !specs[e].exclude_kernel) {
+                fd = openEvent(specs[e].type, specs[e].config, true, group_fd);
+            }
+            if (fd < 0) {
+                if (first_errno == 0) first_errno = errno;
+                continue;
+            }
+            fds_[e] = fd;
+            ioctl(fd, PERF_EVENT_IOC_ID, &ids_[e]);
+            if (leader < 0) leader = e;
+        }
+
+        if (!isOpen()) {
+            error_ = std::string("perf_event_open failed: ") + std::strerror(first_errno);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Close all event descriptors
+     */
+    void close() {
+        for (int e = 0; e < kPerfEventCount; e++) {
+            if (fds_[e] >= 0) ::close(fds_[e]);
+            fds_[e] = -1;
+        }
+        for (int g = 0; g < kGroupCount; g++) leaders_[g] = -1;
+    }
+
+    /**
+     * @brief Reset and start counting
+     */
+    void start() {
+        for (int leader : leaders_) {
+            if (leader < 0) continue;
+            ioctl(fds_[leader], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds_[leader], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+    }
+
+    /**
+     * @brief Stop counting and read the groups
+     */
+    PerfSample stop() {
+        PerfSample sample;
+        for (int leader : leaders_) {
+            if (leader >= 0) ioctl(fds_[leader], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        }
+        for (int leader : leaders_) {
+            if (leader >= 0) readGroup(leader, sample);
+        }
+        return sample;
+    }
+
+    /**
+     * @brief Whether at least one event is counting
+     */
+    bool isOpen() const {
+        for (int leader : leaders_) if (leader >= 0) return true;
+        return false;
+    }
+
+    /**
+     * @brief Reason open() failed
+     */
+    const std::string& getError() const { return error_; }
+};
+
+/**
+ * @brief Print per-tick derived metrics (IPC, cycles/tick, misses/tick)
+ */
+inline void printPerfSummary(const std::string& label, const PerfSample& sample, size_t ticks) {
+    if (!sample.valid()) {
+        std::cout << "  " << label << ": perf counters unavailable" << std::endl;
+        return;
+    }
+    double n = ticks > 0 ? static_cast<double>(ticks) : 1.0;
+    std::ios_base::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    const char* sep = " ";
+    auto field = [&sep](const char* name, double value, int precision) {
+        std::cout << sep << name << " " << std::setprecision(precision) << value;
+        sep = ", ";
+    };
+    std::cout << "  " << label << ":" << std::fixed;
+    if (sample.has(kPerfCycles)) field("cycles/tick", sample.get(kPerfCycles) / n, 2);
+    if (sample.has(kPerfInstructions)) field("instr/tick", sample.get(kPerfInstructions) / n, 2);
+    if (sample.has(kPerfCycles) && sample.has(kPerfInstructions) && sample.get(kPerfCycles) > 0) {
+        field("IPC", static_cast<double>(sample.get(kPerfInstructions)) / sample.get(kPerfCycles), 2);
+    }
+    if (sample.has(kPerfCacheMisses)) field("cache-miss/tick", sample.get(kPerfCacheMisses) / n, 4);
+    if (sample.has(kPerfBranchMisses)) field("branch-miss/tick", sample.get(kPerfBranchMisses) / n, 4);
+    if (sample.has(kPerfLLCMisses)) field("LLC-miss/tick", sample.get(kPerfLLCMisses) / n, 4);
+    if (sample.has(kPerfContextSwitches)) field("ctx-switches", static_cast<double>(sample.get(kPerfContextSwitches)), 0);
+    if (sample.multiplexed) std::cout << " (multiplexed)";
+    std::cout << std::endl;
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+}
+
+} // namespace benchmark
+
+#endif // PERF_COUNTERS_H
@@ -0,0 +1,360 @@
+#ifndef POLLING_INGEST_H
+#define POLLING_INGEST_H
+
+#include "market_tick.h"
+#include "tick_generator.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace market {
+
+/**
+ * @brief A non-blocking tick source polled by PollingIngestLoop
+ *
+ * poll() must never block: it returns what is ready right now, which may
+ * be nothing (an empty poll). Sources stamp ticks with the poll time, so
+ * downstream latency measures ingest to consume.
+ */
+class IngestSource {
+public:
+    virtual ~IngestSource() = default;
+
+    /**
+     * @brief Copy up to max ready ticks into out
+     * @return Number of ticks written; 0 is an empty poll
+     */
+    virtual size_t poll(MarketTick* out, size_t max) = 0;
+
+    /**
+     * @brief True once the source will never produce another tick
+     */
+    virtual bool exhausted() const = 0;
+
+    virtual std::string name() const = 0;
+};
+
+/**
+ * @brief TickGenerator as a source, optionally paced to a target rate
+ *
+ * Unpaced, every poll is productive. Paced, a poll returns only the ticks
+ * whose scheduled time has passed, like a feed arriving at a fixed rate.
+ */
+class GeneratorSource : public IngestSource {
+private:
+    TickGenerator generator_;
+    std::string name_;
+    size_t remaining_;
+    double interval_ns_;       // 0 = unpaced
+    uint64_t start_ns_;
+    size_t emitted_;
+
+public:
+    /**
+     * @param symbol Ticker symbol for every tick
+     * @param total Ticks to produce before the source is exhausted
+     * @param rate_tps Target rate; 0 produces as fast as polled
+     * @param seed Generator seed
+     */
+    GeneratorSource(const std::string& symbol, size_t total, double rate_tps = 0.0, unsigned int seed = 42);
+
+    size_t poll(MarketTick* out, size_t max) override;
+    bool exhausted() const override { return remaining_ == 0; }
+    std::string name() const override { return name_; }
+};
+
+/**
+ * @brief Replays a file of CompactTick records, memory-mapped
+ *
+ * Records are read in file order as fast as they are polled; recorded
+ * timestamps are replaced by the poll time.
+ */
+class ReplayFileSource : public IngestSource {
+private:
+    std::string path_;
+    const CompactTick* records_;
+    size_t count_;
+    size_t position_;
+    size_t mapped_bytes_;
+
+public:
+    /**
+     * @throws std::system_error if the file cannot be opened or mapped
+     */
+    explicit ReplayFileSource(const std::string& path);
+    ~ReplayFileSource() override;
+
+    ReplayFileSource(const ReplayFileSource&) = delete;
+    ReplayFileSource& operator=(const ReplayFileSource&) = delete;
+
+    size_t poll(MarketTick* out, size_t max) override;
+    bool exhausted() const override { return position_ == count_; }
+    std::string name() const override { return "replay:" + path_; }
+
+    size_t size() const { return count_; }
+
+    /**
+     * @brief Write ticks as raw CompactTick records (the replay file format)
+     * @throws std::system_error on I/O failure
+     */
+    static void write(const std::string& path, const std::vector<MarketTick>& ticks);
+};
+
+/**
+ * @brief Non-blocking UDP socket receiving datagrams of CompactTick records
+ *
+ * Each poll drains up to a batch of datagrams with one recvmmsg() call.
+ * A zero-length datagram marks the end of the stream. Like every source,
+ * it is polled from the ingest thread only; other threads may watch for
+ * the end-of-stream marker through endOfStreamReceived().
+ */
+class UdpSource : public IngestSource {
+public:
+    static constexpr size_t kMaxTicksPerDatagram = 32;
+    static constexpr size_t kMaxDatagramsPerPoll = 32;
+
+private:
+    int fd_;
+    uint16_t port_;
+    std::atomic<bool> finished_;          // Written by poll() only; read from any thread
+    std::vector<CompactTick> buffer_;     // kMaxDatagramsPerPoll * kMaxTicksPerDatagram records
+    std::vector<MarketTick> pending_;     // Received but not yet returned (poll max was smaller)
+    size_t pending_pos_;
+
+public:
+    /**
+     * @brief Bind to 127.0.0.1
+     * @param port UDP port; 0 picks a free one (see port())
+     * @param receive_buffer SO_RCVBUF request in bytes; 0 keeps the default
+     * @throws std::system_error if the socket cannot be created or bound
+     */
+    explicit UdpSource(uint16_t port = 0, int receive_buffer = 4 * 1024 * 1024);
+    ~UdpSource() override;
+
+    UdpSource(const UdpSource&) = delete;
+    UdpSource& operator=(const UdpSource&) = delete;
+
+    size_t poll(MarketTick* out, size_t max) override;
+    bool exhausted() const override {
+        return finished_.load(std::memory_order_relaxed) && pending_pos_ == pending_.size();
+    }
+    std::string name() const override { return "udp:" + std::to_string(port_); }
+
+    uint16_t port() const { return port_; }
+
+    /**
+     * @brief Whether poll() has received the end-of-stream marker (safe from any thread)
+     */
+    bool endOfStreamReceived() const { return finished_.load(std::memory_order_acquire); }
+};
+
+/**
+ * @brief Sends CompactTick datagrams to a UdpSource on 127.0.0.1
+ */
+class UdpTickSender {
+private:
+    int fd_;
+
+public:
+    /**
+     * @throws std::system_error if the socket cannot be created
+     */
+    explicit UdpTickSender(uint16_t port);
+    ~UdpTickSender();
+
+    UdpTickSender(const UdpTickSender&) = delete;
+    UdpTickSender& operator=(const UdpTickSender&) = delete;
+
+    /**
+     * @brief Send up to UdpSource::kMaxTicksPerDatagram ticks in one datagram
+     * @return false if the kernel refused the datagram (e.g. buffer full)
+     */
+    bool send(const CompactTick* ticks, size_t count);
+
+    /**
+     * @brief Send the zero-length end-of-stream datagram
+     */
+    bool finish() { return send(nullptr, 0); }
+};
+
+/**
+ * @brief How PollingIngestLoop behaves between polls
+ */
+struct IngestConfig {
+    size_t batch_size = 64;            // Max ticks taken from a source per poll
+    size_t yield_after_idle = 0;       // Yield after this many empty sweeps in a row; 0 = spin only
+};
+
+/**
+ * @brief Poll counts for one source
+ */
+struct IngestSourceStats {
+    std::string name;
+    uint64_t polls = 0;
+    uint64_t productive_polls = 0;
+    uint64_t ticks = 0;
+    uint64_t max_batch = 0;
+
+    uint64_t emptyPolls() const { return polls - productive_polls; }
+
+    /**
+     * @brief Fraction of polls that returned at least one tick
+     */
+    double efficiency() const { return polls == 0 ? 0.0 : static_cast<double>(productive_polls) / polls; }
+
+    double ticksPerProductivePoll() const {
+        return productive_polls == 0 ? 0.0 : static_cast<double>(ticks) / productive_polls;
+    }
+};
+
+/**
+ * @brief Busy-polling, run-to-completion ingest loop
+ *
+ * One thread visits every source in round-robin order. Each poll's batch is
+ * routed by symbol (so per-symbol order is kept) and pushed into the output
+ * queues with one pushBatch() per queue before the next source is polled;
+ * nothing is buffered across polls. The loop spins when every source comes
+ * back empty, optionally yielding after a run of empty sweeps, and returns
+ * when all sources are exhausted or stop() is called.
+ *
+ * @tparam QueueType Output queue of MarketTick with pushBatch(), e.g.
+ *         lockfree::SPSCQueue<MarketTick>; each queue must have one consumer
+ */
+template<typename QueueType>
+class PollingIngestLoop {
+private:
+    IngestConfig config_;
+    std::vector<IngestSource*> sources_;
+    std::vector<IngestSourceStats> stats_;
+    std::vector<QueueType*> outputs_;
+    std::vector<std::vector<MarketTick>> staged_;    // Per-output slice of the current batch
+    std::vector<MarketTick> batch_;
+    std::atomic<bool> stop_;
+    uint64_t sweeps_;
+    uint64_t idle_sweeps_;
+    uint64_t busy_ns_;
+    uint64_t elapsed_ns_;
+
+    size_t route(const MarketTick& tick) const {
+        return outputs_.size() == 1 ? 0 : std::hash<std::string>()(tick.symbol) % outputs_.size();
+    }
+
+    void dispatch(size_t count) {
+        if (outputs_.size() == 1) {
+            outputs_[0]->pushBatch(batch_.data(), count);
+            return;
+        }
+        for (size_t i = 0; i < count; i++) staged_[route(batch_[i])].push_back(batch_[i]);
+        for (size_t q = 0; q < outputs_.size(); q++) {
+            if (staged_[q].empty()) continue;
+            outputs_[q]->pushBatch(staged_[q].data(), staged_[q].size());
+            staged_[q].clear();
+        }
+    }
+
+    static void pause() {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#endif
+    }
+
+public:
+    explicit PollingIngestLoop(const IngestConfig& config = IngestConfig())
+        : config_(config), batch_(config.batch_size), stop_(false),
+          sweeps_(0), idle_sweeps_(0), busy_ns_(0), elapsed_ns_(0) {}
+
+    PollingIngestLoop(const PollingIngestLoop&) = delete;
+    PollingIngestLoop& operator=(const PollingIngestLoop&) = delete;
+
+    void addSource(IngestSource& source) {
+        sources_.push_back(&source);
+        stats_.emplace_back();
+        stats_.back().name = source.name();
+    }
+
+    void addOutput(QueueType& queue) {
+        outputs_.push_back(&queue);
+        staged_.emplace_back();
+        staged_.back().reserve(config_.batch_size);
+    }
+
+    /**
+     * @brief Poll until every source is exhausted or stop() is called
+     */
+    void run() {
+        uint64_t start = getCurrentTimeNanos();
+        size_t idle_run = 0;
+        while (!stop_.load(std::memory_order_relaxed)) {
+            bool any_live = false;
+            bool any_ticks = false;
+            for (size_t s = 0; s < sources_.size(); s++) {
+                IngestSource& source = *sources_[s];
+                if (source.exhausted()) continue;
+                any_live = true;
+
+                IngestSourceStats& st = stats_[s];
+                uint64_t poll_start = getCurrentTimeNanos();
+                size_t n = source.poll(batch_.data(), config_.batch_size);
+                st.polls++;
+                if (n == 0) continue;
+
+                dispatch(n);
+                busy_ns_ += getCurrentTimeNanos() - poll_start;
+                any_ticks = true;
+                st.productive_polls++;
+                st.ticks += n;
+                if (n > st.max_batch) st.max_batch = n;
+            }
+            sweeps_++;
+            if (!any_live) break;
+            if (any_ticks) {
+                idle_run = 0;
+                continue;
+            }
+            idle_sweeps_++;
+            if (config_.yield_after_idle > 0 && ++idle_run >= config_.yield_after_idle) {
+                idle_run = 0;
+                std::this_thread::yield();
+            } else {
+                pause();
+            }
+        }
+        elapsed_ns_ = getCurrentTimeNanos() - start;
+    }
+
+    /**
+     * @brief Ask run() to return after the current sweep (any thread)
+     */
+    void stop() { stop_.store(true, std::memory_order_relaxed); }
+
+    const std::vector<IngestSourceStats>& getSourceStats() const { return stats_; }
+    uint64_t getSweeps() const { return sweeps_; }
+    uint64_t getIdleSweeps() const { return idle_sweeps_; }
+
+    /**
+     * @brief Share of run() time spent polling productive sources and dispatching
+     */
+    double getBusyFraction() const {
+        return elapsed_ns_ == 0 ? 0.0 : static_cast<double>(busy_ns_) / elapsed_ns_;
+    }
+
+    double getElapsedSeconds() const { return elapsed_ns_ / 1e9; }
+
+    uint64_t getTotalTicks() const {
+        uint64_t total = 0;
+        for (const auto& st : stats_) total += st.ticks;
+        return total;
+    }
+};
+
+} // namespace market
+
+#endif // POLLING_INGEST_H
@@ -0,0 +1,252 @@
+#ifndef QUANTILE_SKETCH_H
+#define QUANTILE_SKETCH_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace market {
+
+/**
+ * @brief Mergeable streaming quantile sketch (merging t-digest)
+ *
+ * Keeps at most O(compression) centroids regardless of how many samples are
+ * added. Uses the k1 (arcsine) scale function, so centroids near the tails
+ * stay small and extreme quantiles such as P99/P999 remain accurate.
+ *
+ * Memory is allocated once in the constructor; add() appends to a fixed
+ * buffer and folds it into the centroid list when full. Adjacent centroids
+ * span more than one unit of k over a k range of compression/2, so a
+ * compression never leaves more than compression + 2 centroids.
+ */
+class TDigest {
+private:
+    static constexpr double kPi = 3.14159265358979323846;
+
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+    double compression_;
+    size_t max_centroids_;
+    size_t buffer_capacity_;
+
+    // Mutable so const queries can fold pending samples in first
+    mutable std::vector<Centroid> centroids_;
+    mutable std::vector<Centroid> buffer_;
+    mutable std::vector<Centroid> scratch_;
+    mutable double centroid_weight_;
+    mutable double buffered_weight_;
+    double min_;
+    double max_;
+
+    double kScale(double q) const {
+        return compression_ / (2.0 * kPi) * std::asin(2.0 * q - 1.0);
+    }
+
+    double kInverse(double k) const {
+        return (std::sin(k * 2.0 * kPi / compression_) + 1.0) / 2.0;
+    }
+
+    /**
+     * @brief Largest cumulative quantile the next centroid may reach from q
+     *
+     * k spans [-compression/4, compression/4]; past the top, sin() would
+     * wrap and shrink the limit, so the last step is clamped to q = 1.
+     */
+    double qLimit(double q) const {
+        double k = kScale(q) + 1.0;
+        if (k >= compression_ / 4.0) return 1.0;
+        return kInverse(k);
+    }
+
+    /**
+     * @brief Merge buffered samples into the centroid list
+     */
+    void compress() const {
+        if (buffer_.empty()) return;
+
+        std::sort(buffer_.begin(), buffer_.end(),
+                  [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+
+        scratch_.clear();
+        std::merge(centroids_.begin(), centroids_.end(), buffer_.begin(), buffer_.end(),
+                   std::back_inserter(scratch_),
+                   [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; });
+
+        double total = 0.0;
+        for (const auto& c : scratch_) total += c.weight;
+
+        centroids_.clear();
+        Centroid current = scratch_[0];
+        double weight_so_far = 0.0;
+        double q_limit = total * qLimit(0.0);
+
+        for (size_t i = 1; i < scratch_.size(); i++) {
+            const Centroid& next = scratch_[i];
+            if (weight_so_far + current.weight + next.weight <= q_limit) {
+                current.weight += next.weight;
+                current.mean += (next.mean - current.mean) * next.weight / current.weight;
+            } else {
+                weight_so_far += current.weight;
+                centroids_.push_back(current);
+                q_limit = total * qLimit(weight_so_far / total);
+                current = next;
+            }
+        }
+        centroids_.push_back(current);
+
+        buffer_.clear();
+        centroid_weight_ = total;
+        buffered_weight_ = 0.0;
+    }
+
+    void addWeighted(double value, double weight) {
+        if (buffer_.size() == buffer_capacity_) compress();
+        buffer_.push_back(Centroid{value, weight});
+        buffered_weight_ += weight;
+        if (value < min_) min_ = value;
+        if (value > max_) max_ = value;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param compression Accuracy/size trade-off (centroid budget ~ compression)
+     */
+    explicit TDigest(double compression = 200.0)
+        : compression_(compression),
+          max_centroids_(static_cast<size_t>(std::ceil(compression)) + 8),
+          buffer_capacity_(static_cast<size_t>(std::ceil(compression)) * 5),
+          centroid_weight_(0.0),
+          buffered_weight_(0.0),
+          min_(std::numeric_limits<double>::infinity()),
+          max_(-std::numeric_limits<double>::infinity()) {
+        centroids_.reserve(max_centroids_);
+        buffer_.reserve(buffer_capacity_);
+        scratch_.reserve(max_centroids_ + buffer_capacity_);
+    }
+
+    /**
+     * @brief Add a single sample
+     */
+    void add(double value) { addWeighted(value, 1.0); }
+
+    /**
+     * @brief Merge another digest into this one
+     */
+    void merge(const TDigest& other) {
+        other.compress();
+        for (const auto& c : other.centroids_) {
+            addWeighted(c.mean, c.weight);
+        }
+        if (other.min_ < min_) min_ = other.min_;
+        if (other.max_ > max_) max_ = other.max_;
+    }
+
+    /**
+     * @brief Estimate the value at a quantile
+     * @param q Quantile to estimate (0.0 to 1.0)
+     * @return double Estimated value, 0.0 if no data
+     */
+    double quantile(double q) const {
+        compress();
+        if (centroids_.empty()) return 0.0;
+        if (centroids_.size() == 1) return centroids_[0].mean;
+
+        const double total = centroid_weight_;
+        const double index = q * total;
+        if (index < 1.0) return min_;
+        if (index > total - 1.0) return max_;
+
+        // Left tail: interpolate between min and the first centroid
+        const Centroid& first = centroids_.front();
+        if (first.weight > 1.0 && index < first.weight / 2.0) {
+            return min_ + (index - 1.0) / (first.weight / 2.0 - 1.0) * (first.mean - min_);
+        }
+
+        double weight_so_far = first.weight / 2.0;
+        for (size_t i = 0; i + 1 < centroids_.size(); i++) {
+            const Centroid& left = centroids_[i];
+            const Centroid& right = centroids_[i + 1];
+            double dw = (left.weight + right.weight) / 2.0;
+            if (weight_so_far + dw > index) {
+                // Singleton centroids represent exact samples
+                double left_unit = 0.0;
+                if (left.weight == 1.0) {
+                    if (index - weight_so_far < 0.5) return left.mean;
+                    left_unit = 0.5;
+                }
+                double right_unit = 0.0;
+                if (right.weight == 1.0) {
+                    if (weight_so_far + dw - index <= 0.5) return right.mean;
+                    right_unit = 0.5;
+                }
+                double z1 = index - weight_so_far - left_unit;
+                double z2 = weight_so_far + dw - index - right_unit;
+                return (left.mean * z2 + right.mean * z1) / (z1 + z2);
+            }
+            weight_so_far += dw;
+        }
+
+        // Right tail: interpolate between the last centroid and max
+        const Centroid& last = centroids_.back();
+        if (last.weight > 1.0 && index > total - last.weight / 2.0) {
+            return max_ - (total - index - 1.0) / (last.weight / 2.0 - 1.0) * (max_ - last.mean);
+        }
+        return max_;
+    }
+
+    /**
+     * @brief Get number of samples added
+     */
+    size_t getCount() const {
+        return static_cast<size_t>(centroid_weight_ + buffered_weight_);
+    }
+
+    /**
+     * @brief Get exact minimum sample, 0.0 if no data
+     */
+    double getMin() const { return getCount() == 0 ? 0.0 : min_; }
+
+    /**
+     * @brief Get exact maximum sample, 0.0 if no data
+     */
+    double getMax() const { return getCount() == 0 ? 0.0 : max_; }
+
+    /**
+     * @brief Get number of centroids after folding in pending samples
+     */
+    size_t getCentroidCount() const {
+        compress();
+        return centroids_.size();
+    }
+
+    /**
+     * @brief Approximate heap footprint in bytes (fixed after construction)
+     */
+    size_t getMemoryBytes() const {
+        return (centroids_.capacity() + buffer_.capacity() + scratch_.capacity()) * sizeof(Centroid);
+    }
+
+    /**
+     * @brief Reset sketch (keeps allocated storage)
+     */
+    void reset() {
+        centroids_.clear();
+        buffer_.clear();
+        centroid_weight_ = 0.0;
+        buffered_weight_ = 0.0;
+        min_ = std::numeric_limits<double>::infinity();
+        max_ = -std::numeric_limits<double>::infinity();
+    }
+};
+
+} // namespace market
+
+#endif // QUANTILE_SKETCH_H
@@ -0,0 +1,79 @@
+#ifndef QUEUE_DEPTH_H
+#define QUEUE_DEPTH_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace benchmark {
+
+/**
+ * @brief Producers sample queue depth once per this many pushes (power of two)
+ */
+constexpr size_t kDepthSampleEvery = 64;
+
+/**
+ * @brief Histogram of sampled queue depths with a max watermark
+ *
+ * Buckets are powers of two: 0, 1, 2-3, 4-7, ... Depth is sampled right
+ * after a push, when the queue is deepest, so the watermark is the highest
+ * sampled depth (it can miss a peak between samples by at most
+ * kDepthSampleEvery - 1 ticks).
+ */
+class QueueDepthHistogram {
+public:
+    static constexpr int kBucketCount = 65;
+
+private:
+    uint64_t buckets_[kBucketCount] = {};
+    uint64_t samples_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t max_depth_ = 0;
+
+    static int bucketFor(uint64_t depth) {
+        return depth == 0 ? 0 : 64 - __builtin_clzll(depth);
+    }
+
+public:
+    void add(uint64_t depth) {
+        buckets_[bucketFor(depth)]++;
+        samples_++;
+        sum_ += depth;
+        if (depth > max_depth_) max_depth_ = depth;
+    }
+
+    void merge(const QueueDepthHistogram& other) {
+        for (int i = 0; i < kBucketCount; i++) buckets_[i] += other.buckets_[i];
+        samples_ += other.samples_;
+        sum_ += other.sum_;
+        if (other.max_depth_ > max_depth_) max_depth_ = other.max_depth_;
+    }
+
+    uint64_t getSamples() const { return samples_; }
+    uint64_t getMax() const { return max_depth_; }
+    double getMean() const { return samples_ == 0 ? 0.0 : static_cast<double>(sum_) / samples_; }
+
+    /**
+     * @brief Upper bound of the bucket holding the given percentile (capped at max)
+     * @param percentile 0.0 to 1.0
+     */
+    uint64_t getPercentile(double percentile) const {
+        if (samples_ == 0) return 0;
+        uint64_t rank = static_cast<uint64_t>(percentile * samples_);
+        if (rank >= samples_) rank = samples_ - 1;
+        uint64_t seen = 0;
+        for (int i = 0; i < kBucketCount; i++) {
+            seen += buckets_[i];
+            if (seen > rank) {
+                uint64_t high = i == 0 ? 0 : (i >= 64 ? UINT64_MAX : (uint64_t(1) << i) - 1);
+                return high < max_depth_ ? high : max_depth_;
+            }
+        }
+        return max_depth_;
+    }
+
+    uint64_t getBucket(int index) const { return buckets_[index]; }
+};
+
+} // namespace benchmark
+
+#endif // QUEUE_DEPTH_H
@@ -0,0 +1,216 @@
+#ifndef ROLLING_EXTREMA_H
+#define ROLLING_EXTREMA_H
+
+#include "market_tick.h"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace market {
+
+/**
+ * @brief Fixed-capacity monotonic deque on a power-of-two ring buffer
+ *
+ * Holds candidate extremes in arrival order with values strictly ordered by
+ * Compare from front to back (std::greater for max, std::less for min), so
+ * the front is always the current extreme. Each value is pushed and popped
+ * at most once, giving amortised O(1) updates with no allocation after
+ * construction.
+ *
+ * @tparam Compare Strict ordering that the front must win (e.g. std::greater<double>)
+ */
+template<typename Compare>
+class MonotonicRingBuffer {
+private:
+    struct Entry {
+        double value;
+        uint64_t key;   // Sequence number or timestamp used for expiry
+    };
+
+    std::vector<Entry> entries_;
+    uint64_t mask_;
+    uint64_t head_;
+    uint64_t tail_;
+    Compare compare_;
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Maximum candidates kept, rounded up to a power of two
+     */
+    explicit MonotonicRingBuffer(size_t capacity) : head_(0), tail_(0) {
+        size_t slots = 1;
+        while (slots < capacity) slots <<= 1;
+        entries_.resize(slots);
+        mask_ = slots - 1;
+    }
+
+    /**
+     * @brief Add a value, discarding candidates it dominates
+     *
+     * If the buffer is full the oldest candidate is dropped early.
+     */
+    void push(double value, uint64_t key) {
+        while (tail_ != head_ && !compare_(entries_[(tail_ - 1) & mask_].value, value)) {
+            tail_--;
+        }
+        if (tail_ - head_ == entries_.size()) head_++;
+        entries_[tail_ & mask_] = Entry{value, key};
+        tail_++;
+    }
+
+    /**
+     * @brief Drop candidates whose key is below min_key
+     */
+    void expire(uint64_t min_key) {
+        while (head_ != tail_ && entries_[head_ & mask_].key < min_key) head_++;
+    }
+
+    /**
+     * @brief Get current extreme (undefined if empty)
+     */
+    double front() const { return entries_[head_ & mask_].value; }
+
+    bool empty() const { return head_ == tail_; }
+
+    /**
+     * @brief Get number of candidates held
+     */
+    size_t size() const { return static_cast<size_t>(tail_ - head_); }
+
+    /**
+     * @brief Remove all candidates
+     */
+    void clear() { head_ = tail_ = 0; }
+};
+
+/**
+ * @brief Rolling high/low/range over the last N ticks
+ */
+class RollingMinMaxCalculator {
+private:
+    MonotonicRingBuffer<std::greater<double>> max_;
+    MonotonicRingBuffer<std::less<double>> min_;
+    size_t window_size_;
+    uint64_t sequence_;
+
+public:
+    /**
+     * @brief Constructor
+     * @param window_size Number of ticks in the window
+     */
+    RollingMinMaxCalculator(size_t window_size = 100)
+        : max_(window_size), min_(window_size), window_size_(window_size), sequence_(0) {}
+
+    /**
+     * @brief Add a tick to the rolling window
+     * @param tick Market tick to process
+     */
+    void addTick(const MarketTick& tick) { addPrice(tick.price); }
+
+    /**
+     * @brief Add a single price
+     */
+    void addPrice(double price) {
+        max_.push(price, sequence_);
+        min_.push(price, sequence_);
+        sequence_++;
+        if (sequence_ > window_size_) {
+            max_.expire(sequence_ - window_size_);
+            min_.expire(sequence_ - window_size_);
+        }
+    }
+
+    /**
+     * @brief Get rolling high, 0.0 if no data
+     */
+    double getMax() const { return max_.empty() ? 0.0 : max_.front(); }
+
+    /**
+     * @brief Get rolling low, 0.0 if no data
+     */
+    double getMin() const { return min_.empty() ? 0.0 : min_.front(); }
+
+    /**
+     * @brief Get rolling range (high - low)
+     */
+    double getRange() const { return getMax() - getMin(); }
+
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        max_.clear();
+        min_.clear();
+        sequence_ = 0;
+    }
+};
+
+/**
+ * @brief Rolling high/low/range over the last T nanoseconds of ticks
+ *
+ * The window is (t - window_ns, t] where t is the latest tick's timestamp_ns.
+ * max_ticks bounds the candidates retained per side; a window holding more
+ * monotonic candidates than that loses its oldest ones early.
+ */
+class TimeRollingMinMaxCalculator {
+private:
+    MonotonicRingBuffer<std::greater<double>> max_;
+    MonotonicRingBuffer<std::less<double>> min_;
+    uint64_t window_ns_;
+
+public:
+    /**
+     * @brief Constructor
+     * @param window_ns Window length in nanoseconds
+     * @param max_ticks Candidate capacity per side
+     */
+    TimeRollingMinMaxCalculator(uint64_t window_ns = 1000000000ULL, size_t max_ticks = 4096)
+        : max_(max_ticks), min_(max_ticks), window_ns_(window_ns) {}
+
+    /**
+     * @brief Add a tick to the rolling window
+     * @param tick Market tick to process
+     */
+    void addTick(const MarketTick& tick) { addPrice(tick.price, tick.timestamp_ns); }
+
+    /**
+     * @brief Add a price observed at timestamp_ns
+     */
+    void addPrice(double price, uint64_t timestamp_ns) {
+        max_.push(price, timestamp_ns);
+        min_.push(price, timestamp_ns);
+        if (timestamp_ns >= window_ns_) {
+            max_.expire(timestamp_ns - window_ns_ + 1);
+            min_.expire(timestamp_ns - window_ns_ + 1);
+        }
+    }
+
+    /**
+     * @brief Get rolling high, 0.0 if no data
+     */
+    double getMax() const { return max_.empty() ? 0.0 : max_.front(); }
+
+    /**
+     * @brief Get rolling low, 0.0 if no data
+     */
+    double getMin() const { return min_.empty() ? 0.0 : min_.front(); }
+
+    /**
+     * @brief Get rolling range (high - low)
+     */
+    double getRange() const { return getMax() - getMin(); }
+
+    /**
+     * @brief Reset calculator
+     */
+    void reset() {
+        max_.clear();
+        min_.clear();
+    }
+};
+
+} // namespace market
+
+#endif // ROLLING_EXTREMA_H
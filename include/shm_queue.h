@@ -0,0 +1,344 @@
+#ifndef SHM_QUEUE_H
+#define SHM_QUEUE_H
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace lockfree {
+
+/**
+ * @brief Layout header at offset 0 of every shared-memory queue segment
+ *
+ * The layout is position independent: it holds no pointers, only indices and
+ * byte offsets, so each process may map the segment at a different address.
+ * Producer and consumer indices live on separate cache lines.
+ */
+struct ShmQueueHeader {
+    static constexpr uint64_t kMagic = 0x5155455548444D4DULL;  // "MMDHUEUQ"
+    static constexpr uint32_t kVersion = 1;
+
+    uint64_t magic;
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t capacity;               // Number of slots (power of two)
+    uint64_t slots_offset;           // Byte offset of slot array from segment start
+    uint64_t segment_size;           // Total mapped size in bytes
+    std::atomic<uint32_t> ready;     // Set last by the creator (release)
+    std::atomic<int32_t> writer_pid; // Owning producer process
+    std::atomic<int32_t> reader_pid; // Attached consumer process, 0 if none
+
+    alignas(64) std::atomic<uint64_t> write_index;  // Written by producer only
+    alignas(64) std::atomic<uint64_t> read_index;   // Written by consumer only
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "Shared-memory queue requires address-free 64-bit atomics");
+static_assert(std::atomic<int32_t>::is_always_lock_free,
+              "Shared-memory queue requires address-free 32-bit atomics");
+
+/**
+ * @brief Shared-memory Single Producer Single Consumer ring buffer
+ *
+ * Backed by a POSIX shared memory object (shm_open + mmap) so a feed handler
+ * process can hand ticks to a strategy process. Elements are copied by value
+ * into a fixed ring of power-of-two capacity.
+ *
+ * The consumer's read index is kept in the segment, so a consumer that
+ * crashes can be replaced by a new process that resumes from the last
+ * consumed element. Attach refuses to steal the reader slot while the
+ * previous reader process is still alive.
+ *
+ * @tparam T Trivially copyable element type (e.g. market::CompactTick)
+ */
+template<typename T>
+class ShmSPSCQueue {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "ShmSPSCQueue elements must be trivially copyable");
+
+public:
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+    /**
+     * @brief Create a new segment and open it as the producer
+     *
+     * Fails with EEXIST if the name is already taken, so a live segment owned
+     * by another process is never replaced. To recover the name after a
+     * producer crash, call unlink() first.
+     *
+     * @param name Shared memory object name (e.g. "/mdfh_ticks")
+     * @param capacity Minimum number of slots, rounded up to a power of two
+     * @param huge_pages Round the segment to 2MB and request transparent huge pages
+     * @throws std::system_error if the segment cannot be created or mapped
+     */
+    static std::unique_ptr<ShmSPSCQueue> create(const std::string& name,
+                                                size_t capacity,
+                                                bool huge_pages = false) {
+        size_t slots = 1;
+        while (slots < capacity) slots <<= 1;
+
+        size_t slots_offset = (sizeof(ShmQueueHeader) + 63) & ~size_t(63);
+        size_t segment_size = slots_offset + slots * sizeof(T);
+        size_t page = huge_pages ? kHugePageSize : static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        segment_size = (segment_size + page - 1) & ~(page - 1);
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) throwSystemError("shm_open(" + name + ")");
+        if (ftruncate(fd, static_cast<off_t>(segment_size)) != 0) {
+            int err = errno;
+            close(fd);
+            shm_unlink(name.c_str());
+            throw std::system_error(err, std::generic_category(), "ftruncate(" + name + ")");
+        }
+
+        void* base = nullptr;
+        try {
+            base = mapSegment(fd, segment_size, huge_pages);
+        } catch (...) {
+            shm_unlink(name.c_str());    // mapSegment already closed fd
+            throw;
+        }
+        close(fd);
+
+        auto* header = new (base) ShmQueueHeader();
+        header->magic = ShmQueueHeader::kMagic;
+        header->version = ShmQueueHeader::kVersion;
+        header->element_size = sizeof(T);
+        header->capacity = slots;
+        header->slots_offset = slots_offset;
+        header->segment_size = segment_size;
+        header->writer_pid.store(getpid(), std::memory_order_relaxed);
+        header->reader_pid.store(0, std::memory_order_relaxed);
+        header->write_index.store(0, std::memory_order_relaxed);
+        header->read_index.store(0, std::memory_order_relaxed);
+        header->ready.store(1, std::memory_order_release);
+
+        return std::unique_ptr<ShmSPSCQueue>(new ShmSPSCQueue(name, base, segment_size, true));
+    }
+
+    /**
+     * @brief Attach to an existing segment as the consumer
+     *
+     * Waits up to @p timeout for the creator to finish initialisation, then
+     * validates magic, version and element layout. If a previous reader
+     * process died without detaching, its slot is taken over and consumption
+     * resumes from its last committed read index.
+     *
+     * @throws std::system_error on OS failure or if another live reader is attached
+     * @throws std::runtime_error if the segment layout does not match T
+     */
+    static std::unique_ptr<ShmSPSCQueue> attach(const std::string& name,
+                                                std::chrono::milliseconds timeout = std::chrono::milliseconds(1000)) {
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        int fd = -1;
+        struct stat st{};
+        // The creator may not have sized the object yet
+        while (true) {
+            fd = shm_open(name.c_str(), O_RDWR, 0600);
+            if (fd >= 0 && fstat(fd, &st) == 0 &&
+                static_cast<size_t>(st.st_size) >= sizeof(ShmQueueHeader)) {
+                break;
+            }
+            if (fd >= 0) close(fd);
+            if (std::chrono::steady_clock::now() > deadline) {
+                throw std::system_error(ENOENT, std::generic_category(), "shm attach(" + name + ")");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        size_t segment_size = static_cast<size_t>(st.st_size);
+        void* base = mapSegment(fd, segment_size, false);
+        close(fd);
+
+        auto* header = static_cast<ShmQueueHeader*>(base);
+        while (header->ready.load(std::memory_order_acquire) == 0) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                munmap(base, segment_size);
+                throw std::runtime_error("shm attach(" + name + "): segment never became ready");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        if (header->magic != ShmQueueHeader::kMagic ||
+            header->version != ShmQueueHeader::kVersion ||
+            header->element_size != sizeof(T) ||
+            header->segment_size != segment_size ||
+            header->slots_offset + header->capacity * sizeof(T) > segment_size) {
+            munmap(base, segment_size);
+            throw std::runtime_error("shm attach(" + name + "): incompatible segment layout");
+        }
+
+        // Claim the reader slot, taking it over if the previous reader died
+        int32_t self = getpid();
+        int32_t current = header->reader_pid.load(std::memory_order_acquire);
+        while (true) {
+            if (current != 0 && current != self && processAlive(current)) {
+                munmap(base, segment_size);
+                throw std::system_error(EBUSY, std::generic_category(),
+                                        "shm attach(" + name + "): reader already attached");
+            }
+            if (header->reader_pid.compare_exchange_weak(current, self, std::memory_order_acq_rel)) {
+                break;
+            }
+        }
+
+        return std::unique_ptr<ShmSPSCQueue>(new ShmSPSCQueue(name, base, segment_size, false));
+    }
+
+    /**
+     * @brief Remove the named segment (existing mappings stay valid)
+     */
+    static void unlink(const std::string& name) { shm_unlink(name.c_str()); }
+
+    /**
+     * @brief Destructor - releases the reader slot and unmaps the segment
+     */
+    ~ShmSPSCQueue() {
+        if (!is_producer_) {
+            int32_t self = getpid();
+            header_->reader_pid.compare_exchange_strong(self, 0, std::memory_order_release);
+        }
+        munmap(header_, segment_size_);
+    }
+
+    // Disable copy and move
+    ShmSPSCQueue(const ShmSPSCQueue&) = delete;
+    ShmSPSCQueue& operator=(const ShmSPSCQueue&) = delete;
+
+    /**
+     * @brief Try to push an element (producer only)
+     * @return true if pushed, false if the ring is full
+     */
+    bool tryPush(const T& value) {
+        uint64_t write = header_->write_index.load(std::memory_order_relaxed);
+        if (write - cached_read_ == capacity_) {
+            cached_read_ = header_->read_index.load(std::memory_order_acquire);
+            if (write - cached_read_ == capacity_) return false;
+        }
+        slots_[write & mask_] = value;
+        header_->write_index.store(write + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Push an element, yielding while the ring is full (producer only)
+     *
+     * Waits forever if the consumer stops draining; when the consumer may
+     * die, loop on tryPush() and check its liveness between attempts.
+     */
+    void push(const T& value) {
+        while (!tryPush(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Pop an element (consumer only)
+     * @return std::optional<T> The popped element, or nullopt if queue is empty
+     */
+    std::optional<T> pop() {
+        uint64_t read = header_->read_index.load(std::memory_order_relaxed);
+        if (read == cached_write_) {
+            cached_write_ = header_->write_index.load(std::memory_order_acquire);
+            if (read == cached_write_) return std::nullopt;
+        }
+        T value = slots_[read & mask_];
+        header_->read_index.store(read + 1, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     * @brief Check if queue is empty
+     */
+    bool empty() const {
+        return header_->read_index.load(std::memory_order_acquire) ==
+               header_->write_index.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Approximate number of queued elements
+     */
+    size_t size() const {
+        uint64_t read = header_->read_index.load(std::memory_order_acquire);
+        uint64_t write = header_->write_index.load(std::memory_order_acquire);
+        return static_cast<size_t>(write - read);
+    }
+
+    /**
+     * @brief Get ring capacity in elements
+     */
+    size_t capacity() const { return capacity_; }
+
+    /**
+     * @brief Get segment name
+     */
+    const std::string& name() const { return name_; }
+
+private:
+    ShmSPSCQueue(const std::string& name, void* base, size_t segment_size, bool is_producer)
+        : name_(name),
+          header_(static_cast<ShmQueueHeader*>(base)),
+          slots_(reinterpret_cast<T*>(static_cast<char*>(base) + header_->slots_offset)),
+          capacity_(header_->capacity),
+          mask_(header_->capacity - 1),
+          segment_size_(segment_size),
+          is_producer_(is_producer),
+          cached_read_(header_->read_index.load(std::memory_order_acquire)),
+          cached_write_(header_->write_index.load(std::memory_order_acquire)) {}
+
+    static void* mapSegment(int fd, size_t size, bool huge_pages) {
+        void* base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+        if (base == MAP_FAILED) {
+            int err = errno;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), "mmap");
+        }
+#ifdef MADV_HUGEPAGE
+        // Best effort: honoured when shmem THP is enabled ("advise" or "always")
+        if (huge_pages) madvise(base, size, MADV_HUGEPAGE);
+#else
+        (void)huge_pages;
+#endif
+        return base;
+    }
+
+    static bool processAlive(int32_t pid) {
+        return kill(pid, 0) == 0 || errno == EPERM;
+    }
+
+    [[noreturn]] static void throwSystemError(const std::string& what) {
+        throw std::system_error(errno, std::generic_category(), what);
+    }
+
+    std::string name_;
+    ShmQueueHeader* header_;
+    T* slots_;
+    uint64_t capacity_;
+    uint64_t mask_;
+    size_t segment_size_;
+    bool is_producer_;
+
+    // Process-local index caches to avoid touching the other side's cache line
+    alignas(64) uint64_t cached_read_;   // Producer's view of read_index
+    alignas(64) uint64_t cached_write_;  // Consumer's view of write_index
+};
+
+} // namespace lockfree
+
+#endif // SHM_QUEUE_H
@@ -0,0 +1,65 @@
+#ifndef SIMD_KERNELS_H
+#define SIMD_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace market {
+namespace simd {
+
+/**
+ * @brief Per-batch sums needed by the analytics calculators
+ */
+struct BatchSums {
+    double price_volume;   // Σ(price * volume), VWAP numerator
+    int64_t volume;        // Σ(volume), VWAP denominator
+    int64_t buy_volume;    // Σ(volume | side == 'B')
+    int64_t sell_volume;   // Σ(volume | side == 'S')
+    double price_sum;      // Σ(price)
+};
+
+/**
+ * @brief Instruction set used by a kernel implementation
+ */
+enum class KernelLevel {
+    Scalar,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @brief Function table for one kernel implementation
+ *
+ * Integer sums are exact at every level. Floating-point sums are
+ * accumulated in 4 (AVX2) or 8 (AVX-512) lanes and reduced at the end, so
+ * they are not bit-identical to the sequential scalar engine; the relative
+ * difference is bounded by about n * 2^-53 (below 1e-9 for batches of up to
+ * a million ticks with positive prices).
+ */
+struct KernelTable {
+    KernelLevel level;
+    const char* name;
+    BatchSums (*batch_sums)(const double* prices, const int32_t* volumes,
+                            const char* sides, size_t count);
+    double (*sum)(const double* values, size_t count);
+};
+
+/**
+ * @brief Best kernel for this CPU, chosen once on first use
+ */
+const KernelTable& kernels();
+
+/**
+ * @brief Kernel table for a specific level (falls back to scalar if unsupported)
+ */
+const KernelTable& kernelsFor(KernelLevel level);
+
+/**
+ * @brief Check whether the CPU and compiler support a kernel level
+ */
+bool isSupported(KernelLevel level);
+
+} // namespace simd
+} // namespace market
+
+#endif // SIMD_KERNELS_H
@@ -0,0 +1,220 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "analytics.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace market {
+
+/**
+ * @brief Single-writer sequence lock holding a trivially copyable value
+ *
+ * The writer bumps the sequence to odd, copies the value in, and bumps it
+ * back to even; it never waits for readers. Readers copy the value and
+ * retry if the sequence was odd or changed during the copy, so they never
+ * block the writer and never observe a torn value. The payload is stored as
+ * relaxed atomic words so concurrent reads are not a data race.
+ *
+ * @tparam T Trivially copyable payload
+ */
+template<typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock payload must be trivially copyable");
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    alignas(64) std::atomic<uint64_t> sequence_;
+    std::atomic<uint64_t> words_[kWords];
+
+public:
+    SeqLock() : sequence_(0) {
+        for (auto& w : words_) w.store(0, std::memory_order_relaxed);
+    }
+
+    // Disable copy and move
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+    /**
+     * @brief Publish a new value (single writer only)
+     */
+    void store(const T& value) {
+        uint64_t buffer[kWords] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+
+        uint64_t seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < kWords; i++) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+        sequence_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Try to read a consistent value once
+     * @return true if out holds a consistent value
+     */
+    bool tryLoad(T& out) const {
+        uint64_t before = sequence_.load(std::memory_order_acquire);
+        if (before & 1) return false;
+
+        uint64_t buffer[kWords];
+        for (size_t i = 0; i < kWords; i++) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) != before) return false;
+
+        std::memcpy(&out, buffer, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Read a consistent value, retrying while a write is in progress
+     */
+    T load() const {
+        T out;
+        while (!tryLoad(out)) {}
+        return out;
+    }
+
+    /**
+     * @brief Get number of completed publications
+     */
+    uint64_t getVersion() const { return sequence_.load(std::memory_order_acquire) / 2; }
+};
+
+/**
+ * @brief Point-in-time copy of one symbol's analytics
+ */
+struct AnalyticsSnapshot {
+    uint64_t sequence;          // Publication number for this symbol
+    uint64_t publish_time_ns;   // When the consumer published it
+    uint64_t tick_count;
+    double vwap;
+    double rolling_average;
+    double rolling_high;
+    double rolling_low;
+    double ewma_price;
+    double ewma_volatility;
+    double rolling_stddev;
+    int64_t imbalance;
+    int64_t buy_volume;
+    int64_t sell_volume;
+};
+
+/**
+ * @brief Publishes per-symbol analytics snapshots from the consumer thread
+ *
+ * The consumer calls onTick() after updating a symbol's AnalyticsEngine. A
+ * snapshot is published every publish_every_ticks ticks or once
+ * publish_interval_ns has elapsed since the previous one, whichever comes
+ * first. Any number of reader threads may read concurrently without ever
+ * blocking the consumer: tryRead() is a single wait-free attempt, and read()
+ * only retries while a publish of that symbol is in progress.
+ */
+class SnapshotPublisher {
+private:
+    /**
+     * @brief Writer-only bookkeeping, updated on every tick
+     *
+     * Kept apart from the seqlocks so per-tick updates never invalidate the
+     * lines readers poll; only a publish touches a symbol's seqlock.
+     */
+    struct WriterState {
+        uint64_t ticks_since_publish = 0;
+        uint64_t last_publish_ns = 0;
+        uint64_t sequence = 0;
+    };
+
+    std::vector<SeqLock<AnalyticsSnapshot>> locks_;    // Shared with readers
+    std::vector<WriterState> writers_;                 // Consumer thread only
+    uint64_t publish_every_ticks_;
+    uint64_t publish_interval_ns_;
+
+public:
+    /**
+     * @brief Constructor
+     * @param num_symbols Number of symbol slots (indexed 0..num_symbols-1)
+     * @param publish_every_ticks Publish after this many ticks (0 disables)
+     * @param publish_interval_ns Publish after this much time (0 disables)
+     */
+    SnapshotPublisher(size_t num_symbols, uint64_t publish_every_ticks = 64,
+                      uint64_t publish_interval_ns = 100000)
+        : locks_(num_symbols), writers_(num_symbols),
+          publish_every_ticks_(publish_every_ticks),
+          publish_interval_ns_(publish_interval_ns) {}
+
+    /**
+     * @brief Notify that a symbol's engine processed a tick (consumer thread)
+     * @param symbol_idx Symbol slot
+     * @param engine Engine holding that symbol's analytics
+     * @param now_ns Current time; pass the tick timestamp to avoid a clock read
+     * @return true if a snapshot was published
+     */
+    bool onTick(size_t symbol_idx, const AnalyticsEngine& engine, uint64_t now_ns) {
+        WriterState& slot = writers_[symbol_idx];
+        slot.ticks_since_publish++;
+
+        bool due = (publish_every_ticks_ != 0 && slot.ticks_since_publish >= publish_every_ticks_) ||
+                   (publish_interval_ns_ != 0 && now_ns - slot.last_publish_ns >= publish_interval_ns_);
+        if (!due) return false;
+
+        publish(symbol_idx, engine, now_ns);
+        return true;
+    }
+
+    /**
+     * @brief Publish a snapshot unconditionally (consumer thread)
+     */
+    void publish(size_t symbol_idx, const AnalyticsEngine& engine, uint64_t now_ns) {
+        WriterState& slot = writers_[symbol_idx];
+
+        AnalyticsSnapshot snap;
+        snap.sequence = ++slot.sequence;
+        snap.publish_time_ns = now_ns;
+        snap.tick_count = engine.getTickCount();
+        snap.vwap = engine.getVWAP();
+        snap.rolling_average = engine.getRollingAverage();
+        snap.rolling_high = engine.getRollingHigh();
+        snap.rolling_low = engine.getRollingLow();
+        snap.ewma_price = engine.getEWMAPrice();
+        snap.ewma_volatility = engine.getEWMAVolatility();
+        snap.rolling_stddev = engine.getRollingStdDev();
+        snap.imbalance = engine.getImbalance();
+        snap.buy_volume = engine.getBuyVolume();
+        snap.sell_volume = engine.getSellVolume();
+        locks_[symbol_idx].store(snap);
+
+        slot.ticks_since_publish = 0;
+        slot.last_publish_ns = now_ns;
+    }
+
+    /**
+     * @brief Read the latest snapshot for a symbol (any thread)
+     */
+    AnalyticsSnapshot read(size_t symbol_idx) const { return locks_[symbol_idx].load(); }
+
+    /**
+     * @brief Single read attempt; false if it raced with a publish
+     */
+    bool tryRead(size_t symbol_idx, AnalyticsSnapshot& out) const {
+        return locks_[symbol_idx].tryLoad(out);
+    }
+
+    /**
+     * @brief Get number of symbol slots
+     */
+    size_t getSymbolCount() const { return locks_.size(); }
+};
+
+} // namespace market
+
+#endif // SNAPSHOT_H
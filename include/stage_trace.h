@@ -0,0 +1,275 @@
+#ifndef STAGE_TRACE_H
+#define STAGE_TRACE_H
+
+#include <atomic>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief Pipeline stages of a traced tick, in order
+ */
+enum TraceStage {
+    kStageGenerate = 0,   // TickGenerator call
+    kStageEnqueue,        // queue.push()
+    kStageQueueDwell,     // Push returned -> consumer starts the pop that returns the tick
+    kStageDequeue,        // queue.pop() call that returned the tick
+    kStageAnalytics,      // Latency bookkeeping + AnalyticsEngine::processTick
+    kStageTotal,          // Generation start -> analytics done
+    kStageCount
+};
+
+inline const char* stageName(TraceStage stage) {
+    switch (stage) {
+        case kStageGenerate: return "generate";
+        case kStageEnqueue: return "enqueue";
+        case kStageQueueDwell: return "queue dwell";
+        case kStageDequeue: return "dequeue";
+        case kStageAnalytics: return "analytics";
+        case kStageTotal: return "end-to-end";
+        default: return "unknown";
+    }
+}
+
+/**
+ * @brief Fixed-size log-linear histogram of nanosecond durations
+ *
+ * Values below 16 ns get exact buckets; above that each power of two is
+ * split into 8 sub-buckets, so percentiles are within 12.5% of the true
+ * value. Count, sum and max are exact. No allocation after construction.
+ */
+class StageHistogram {
+public:
+    static constexpr int kSubBuckets = 8;
+    static constexpr int kBucketCount = 16 + 60 * kSubBuckets;
+
+private:
+    uint64_t buckets_[kBucketCount] = {};
+    uint64_t count_ = 0;
+    uint64_t sum_ns_ = 0;
+    uint64_t max_ns_ = 0;
+
+    static int bucketFor(uint64_t ns) {
+        if (ns < 16) return static_cast<int>(ns);
+        int msb = 63 - __builtin_clzll(ns);
+        int sub = static_cast<int>((ns >> (msb - 3)) & (kSubBuckets - 1));
+        return 16 + (msb - 4) * kSubBuckets + sub;
+    }
+
+    static uint64_t bucketLow(int index) {
+        if (index < 16) return static_cast<uint64_t>(index);
+        int msb = (index - 16) / kSubBuckets + 4;
+        uint64_t sub = static_cast<uint64_t>((index - 16) % kSubBuckets);
+        return (uint64_t(1) << msb) + (sub << (msb - 3));
+    }
+
+public:
+    void add(uint64_t ns) {
+        buckets_[bucketFor(ns)]++;
+        count_++;
+        sum_ns_ += ns;
+        if (ns > max_ns_) max_ns_ = ns;
+    }
+
+    void merge(const StageHistogram& other) {
+        for (int i = 0; i < kBucketCount; i++) buckets_[i] += other.buckets_[i];
+        count_ += other.count_;
+        sum_ns_ += other.sum_ns_;
+        if (other.max_ns_ > max_ns_) max_ns_ = other.max_ns_;
+    }
+
+    uint64_t getCount() const { return count_; }
+    uint64_t getMaxNanos() const { return max_ns_; }
+    double getMeanNanos() const { return count_ == 0 ? 0.0 : static_cast<double>(sum_ns_) / count_; }
+
+    /**
+     * @brief Percentile estimate (midpoint of the containing bucket, capped at max)
+     * @param percentile 0.0 to 1.0
+     */
+    double getPercentileNanos(double percentile) const {
+        if (count_ == 0) return 0.0;
+        uint64_t rank = static_cast<uint64_t>(percentile * count_);
+        if (rank >= count_) rank = count_ - 1;
+        uint64_t seen = 0;
+        for (int i = 0; i < kBucketCount; i++) {
+            seen += buckets_[i];
+            if (seen > rank) {
+                double low = static_cast<double>(bucketLow(i));
+                double high = i + 1 < kBucketCount ? static_cast<double>(bucketLow(i + 1)) : low;
+                double mid = i < 16 ? low : (low + high) / 2.0;
+                return mid < max_ns_ ? mid : static_cast<double>(max_ns_);
+            }
+        }
+        return static_cast<double>(max_ns_);
+    }
+
+    /**
+     * @brief Number of samples below a bound (bucket resolution)
+     */
+    uint64_t countBelow(uint64_t bound_ns) const {
+        uint64_t total = 0;
+        for (int i = 0; i < kBucketCount && bucketLow(i) < bound_ns; i++) total += buckets_[i];
+        return total;
+    }
+};
+
+/**
+ * @brief Per-stage histograms for one or more runs
+ */
+struct StageBreakdown {
+    StageHistogram stages[kStageCount];
+    uint64_t sample_every = 0;    // 1-in-N sampling used; 0 = tracing was off
+
+    bool valid() const { return stages[kStageTotal].getCount() > 0; }
+
+    void merge(const StageBreakdown& other) {
+        for (int s = 0; s < kStageCount; s++) stages[s].merge(other.stages[s]);
+        if (sample_every == 0) sample_every = other.sample_every;
+    }
+};
+
+/**
+ * @brief Stage timestamps of one sampled tick
+ *
+ * The producer fills the first three, the consumer the last three; they
+ * are only read after both threads have been joined.
+ */
+struct StageTimestamps {
+    uint64_t generate_start = 0;
+    uint64_t generated = 0;
+    uint64_t enqueued = 0;
+    uint64_t dequeue_start = 0;
+    uint64_t dequeued = 0;
+    uint64_t processed = 0;
+};
+
+/**
+ * @brief Samples 1 in N ticks and records where their time goes
+ *
+ * A sampled tick carries a trace id (MarketTick::trace_id) naming its slot
+ * in a table sized for the whole run, so producer and consumer never share
+ * a slot with another tick and nothing needs to be synchronised beyond the
+ * queue itself. Unsampled ticks cost the producer one counter decrement.
+ * The consumer cannot know in advance which pop returns a sampled tick, so
+ * with a tracer attached it also reads the clock before every pop.
+ */
+class StageTracer {
+private:
+    std::vector<StageTimestamps> slots_;
+    std::atomic<uint32_t> next_id_;
+    uint64_t sample_every_;
+
+public:
+    /**
+     * @brief Constructor
+     * @param max_ticks Ticks the run will produce (sizes the slot table)
+     * @param sample_every Trace one tick in this many
+     * @param producers Producer threads (each may sample one extra tick)
+     */
+    StageTracer(size_t max_ticks, uint64_t sample_every, size_t producers = 1)
+        : slots_(max_ticks / (sample_every ? sample_every : 1) + producers + 1),
+          next_id_(1),
+          sample_every_(sample_every ? sample_every : 1) {}
+
+    // Disable copy and move
+    StageTracer(const StageTracer&) = delete;
+    StageTracer& operator=(const StageTracer&) = delete;
+
+    uint64_t getSampleEvery() const { return sample_every_; }
+
+    /**
+     * @brief Reserve a trace id for a sampled tick; 0 if the table is full
+     */
+    uint32_t begin() {
+        uint32_t id = next_id_.fetch_add(1, std::memory_order_relaxed);
+        return id < slots_.size() ? id : 0;
+    }
+
+    StageTimestamps& slot(uint32_t id) { return slots_[id]; }
+
+    /**
+     * @brief Turn the recorded timestamps into per-stage histograms
+     *
+     * Call after producers and consumers have been joined. A pop that started
+     * before the push finished counts as zero dwell; its dequeue time runs
+     * from the end of the push.
+     */
+    StageBreakdown summarize() const {
+        StageBreakdown breakdown;
+        breakdown.sample_every = sample_every_;
+        uint32_t used = next_id_.load(std::memory_order_relaxed);
+        for (uint32_t id = 1; id < used && id < slots_.size(); id++) {
+            const StageTimestamps& t = slots_[id];
+            if (t.processed == 0) continue;    // Not consumed
+            uint64_t pop_start = t.dequeue_start > t.enqueued ? t.dequeue_start : t.enqueued;
+            breakdown.stages[kStageGenerate].add(t.generated - t.generate_start);
+            breakdown.stages[kStageEnqueue].add(t.enqueued - t.generated);
+            breakdown.stages[kStageQueueDwell].add(pop_start - t.enqueued);
+            breakdown.stages[kStageDequeue].add(t.dequeued > pop_start ? t.dequeued - pop_start : 0);
+            breakdown.stages[kStageAnalytics].add(t.processed - t.dequeued);
+            breakdown.stages[kStageTotal].add(t.processed - t.generate_start);
+        }
+        return breakdown;
+    }
+};
+
+/**
+ * @brief Print per-stage percentiles, share of end-to-end time and a decade histogram
+ */
+inline void printStageBreakdown(const std::string& label, const StageBreakdown& breakdown) {
+    if (!breakdown.valid()) {
+        std::cout << "  " << label << ": no traced ticks" << std::endl;
+        return;
+    }
+    std::ios_base::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    const StageHistogram& total = breakdown.stages[kStageTotal];
+
+    std::cout << "  " << label << ": " << total.getCount() << " traced ticks (1 in "
+              << breakdown.sample_every << "), latency in μs" << std::endl;
+    std::cout << "    " << std::left << std::setw(13) << "Stage" << std::right
+              << std::setw(10) << "Mean" << std::setw(10) << "P50" << std::setw(10) << "P99"
+              << std::setw(10) << "P999" << std::setw(11) << "Max" << std::setw(8) << "Share" << std::endl;
+    std::cout << std::fixed;
+    for (int s = 0; s < kStageCount; s++) {
+        const StageHistogram& h = breakdown.stages[s];
+        double share = total.getMeanNanos() > 0.0 ? 100.0 * h.getMeanNanos() / total.getMeanNanos() : 0.0;
+        std::cout << "    " << std::left << std::setw(13) << stageName(static_cast<TraceStage>(s)) << std::right
+                  << std::setprecision(3)
+                  << std::setw(10) << h.getMeanNanos() / 1000.0
+                  << std::setw(10) << h.getPercentileNanos(0.50) / 1000.0
+                  << std::setw(10) << h.getPercentileNanos(0.99) / 1000.0
+                  << std::setw(10) << h.getPercentileNanos(0.999) / 1000.0
+                  << std::setw(11) << h.getMaxNanos() / 1000.0
+                  << std::setprecision(1) << std::setw(7) << share << "%" << std::endl;
+    }
+
+    // Share of samples per decade (setw counts bytes, and "μ" is two)
+    const uint64_t bounds[] = {100, 1000, 10000, 100000, 1000000};
+    std::cout << "    " << std::left << std::setw(13) << "Histogram" << std::right
+              << std::setw(8) << "<100ns" << std::setw(9) << "<1μs" << std::setw(9) << "<10μs"
+              << std::setw(9) << "<100μs" << std::setw(8) << "<1ms" << std::setw(8) << ">=1ms" << std::endl;
+    for (int s = 0; s < kStageCount; s++) {
+        const StageHistogram& h = breakdown.stages[s];
+        double n = static_cast<double>(h.getCount());
+        std::cout << "    " << std::left << std::setw(13) << stageName(static_cast<TraceStage>(s)) << std::right
+                  << std::setprecision(1);
+        uint64_t below_prev = 0;
+        for (uint64_t bound : bounds) {
+            uint64_t below = h.countBelow(bound);
+            std::cout << std::setw(7) << 100.0 * (below - below_prev) / n << "%";
+            below_prev = below;
+        }
+        std::cout << std::setw(7) << 100.0 * (h.getCount() - below_prev) / n << "%" << std::endl;
+    }
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+}
+
+} // namespace benchmark
+
+#endif // STAGE_TRACE_H
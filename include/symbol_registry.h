@@ -0,0 +1,188 @@
+#ifndef SYMBOL_REGISTRY_H
+#define SYMBOL_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace market {
+
+/**
+ * @brief Dense integer id for an interned symbol
+ */
+using SymbolId = uint32_t;
+
+constexpr SymbolId kInvalidSymbolId = UINT32_MAX;
+
+/**
+ * @brief Symbol interning table: perfect hash over the day's universe
+ *
+ * The start-of-day symbol list gets a perfect hash (hash and displace:
+ * keys are split into buckets, and each bucket gets a displacement that
+ * sends all of its keys to free slots), so a lookup is two multiplies, one
+ * displacement load and one key compare. The slot table runs at a 0.99
+ * load factor and the build tries a bounded number of seeds; keys of a
+ * bucket that still finds no displacement go to a small spill table built
+ * alongside. Symbols seen later go to a dynamic open-addressing table.
+ *
+ * Symbols of up to 8 bytes are packed into a uint64_t key (zero-padded),
+ * so comparing keys compares the symbol. Longer symbols, and the rare
+ * 8-byte symbol whose last byte is not ASCII, are keyed by a 64-bit hash
+ * with the top bit set and confirmed with a string compare.
+ *
+ * Ids are dense: universe symbols get 0..n-1 in list order, later symbols
+ * n, n+1, ... Universe names live apart from interned ones, so find() on
+ * universe symbols only reads storage fixed at construction and is safe
+ * from any thread, even during intern(). intern() and find() of other
+ * symbols must not race with intern().
+ */
+class SymbolRegistry {
+private:
+    struct DynamicSlot {
+        uint64_t key;      // 0 = empty
+        SymbolId id;
+    };
+
+    // Static perfect hash
+    uint64_t seed_;
+    size_t bucket_count_;
+    std::vector<uint32_t> displacements_;    // Per bucket
+    std::vector<uint64_t> static_keys_;      // Per slot
+    std::vector<SymbolId> static_ids_;       // Per slot
+    size_t static_count_;                    // Keys placed in the slot table
+    std::vector<DynamicSlot> spilled_;       // Universe keys no displacement placed; fixed after construction
+
+    // Dynamic fallback (linear probing, power-of-two capacity)
+    std::vector<DynamicSlot> dynamic_;
+    size_t dynamic_count_;
+
+    std::vector<std::string> universe_names_;    // Ids 0..n-1; never modified after construction
+    std::vector<std::string> dynamic_names_;     // Ids n, n+1, ...; appended by intern()
+
+    static constexpr uint64_t kHashedKeyBit = uint64_t(1) << 63;
+
+    static uint64_t mix(uint64_t x) {
+        // murmur3 fmix64
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+    }
+
+    /**
+     * @brief Map a 64-bit hash onto [0, n) without a division
+     */
+    static size_t reduce(uint64_t hash, size_t n) {
+        __extension__ typedef unsigned __int128 Wide;
+        return static_cast<size_t>((static_cast<Wide>(hash) * n) >> 64);
+    }
+
+    size_t bucketOf(uint64_t key) const { return reduce(mix(key ^ seed_), bucket_count_); }
+
+    size_t slotOf(uint64_t key, uint32_t displacement) const {
+        return reduce(mix(key + seed_ + 0x9e3779b97f4a7c15ULL * (displacement + 1)), static_keys_.size());
+    }
+
+    bool sameSymbol(uint64_t key, SymbolId id, std::string_view symbol) const {
+        return (key & kHashedKeyBit) == 0 || name(id) == symbol;
+    }
+
+    SymbolId findIn(const std::vector<DynamicSlot>& table, uint64_t key, std::string_view symbol) const;
+    SymbolId findUnplaced(uint64_t key, std::string_view symbol) const {
+        if (!spilled_.empty()) {
+            SymbolId id = findIn(spilled_, key, symbol);
+            if (id != kInvalidSymbolId) return id;
+        }
+        return dynamic_count_ == 0 ? kInvalidSymbolId : findIn(dynamic_, key, symbol);
+    }
+    void insertDynamic(uint64_t key, SymbolId id);
+    void build(const std::vector<uint64_t>& keys);
+    std::vector<uint32_t> place(const std::vector<uint64_t>& keys, bool spill);
+
+public:
+    /**
+     * @brief Build the perfect hash over a symbol universe (duplicates are ignored)
+     * @param universe The day's symbols; ids follow this order
+     */
+    explicit SymbolRegistry(const std::vector<std::string>& universe = {});
+
+    /**
+     * @brief Lookup key for a symbol (packed bytes, or tagged hash when it does not fit)
+     */
+    static uint64_t encode(std::string_view symbol) {
+        size_t len = symbol.size();
+        if (len > 0 && len <= 8 && (len < 8 || static_cast<unsigned char>(symbol[7]) < 0x80)) {
+            // Byte i goes to bits 8i..8i+7, the same layout as memcpy on little-endian
+            uint64_t key = 0;
+            for (size_t i = 0; i < len; i++) key |= uint64_t(static_cast<unsigned char>(symbol[i])) << (8 * i);
+            if (key != 0) return key;    // 0 marks an empty slot
+        }
+        // FNV-1a, mixed, tagged so it never equals a packed key
+        uint64_t h = 0xcbf29ce484222325ULL;
+        for (char c : symbol) h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+        return mix(h) | kHashedKeyBit;
+    }
+
+    /**
+     * @brief Look up a symbol
+     * @return Its id, or kInvalidSymbolId if it was never registered
+     */
+    SymbolId find(std::string_view symbol) const {
+        uint64_t key = encode(symbol);
+        if (!static_keys_.empty()) {
+            size_t slot = slotOf(key, displacements_[bucketOf(key)]);
+            if (static_keys_[slot] == key && sameSymbol(key, static_ids_[slot], symbol)) {
+                return static_ids_[slot];
+            }
+        }
+        return findUnplaced(key, symbol);
+    }
+
+    /**
+     * @brief Look up a packed key of a symbol of at most 8 bytes (e.g. CompactTick::symbol)
+     *
+     * Skips encoding entirely; only valid for keys encode() would pack. On
+     * little-endian hosts a memcpy of the zero-padded 8 bytes is such a key.
+     */
+    SymbolId findPacked(uint64_t key) const {
+        if (!static_keys_.empty()) {
+            size_t slot = slotOf(key, displacements_[bucketOf(key)]);
+            if (static_keys_[slot] == key) return static_ids_[slot];
+        }
+        return findUnplaced(key, std::string_view());
+    }
+
+    /**
+     * @brief Look up a symbol, registering it in the dynamic table if unseen
+     */
+    SymbolId intern(std::string_view symbol);
+
+    /**
+     * @brief Symbol text for an id
+     */
+    const std::string& name(SymbolId id) const {
+        return id < universe_names_.size() ? universe_names_[id] : dynamic_names_[id - universe_names_.size()];
+    }
+
+    size_t size() const { return universe_names_.size() + dynamic_names_.size(); }
+    size_t staticSize() const { return static_count_; }
+    size_t spilledSize() const { return universe_names_.size() - static_count_; }
+    size_t dynamicSize() const { return dynamic_count_; }
+
+    /**
+     * @brief Bytes held by the lookup structures (not counting symbol names)
+     */
+    size_t getMemoryBytes() const {
+        return displacements_.capacity() * sizeof(uint32_t) + static_keys_.capacity() * sizeof(uint64_t) +
+               static_ids_.capacity() * sizeof(SymbolId) + (spilled_.capacity() + dynamic_.capacity()) * sizeof(DynamicSlot);
+    }
+};
+
+} // namespace market
+
+#endif // SYMBOL_REGISTRY_H
@@ -0,0 +1,202 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace market {
+
+/**
+ * @brief Live counters owned by one pipeline thread
+ *
+ * Only the owning thread writes a slot, so updates are relaxed load + store
+ * pairs (no locked read-modify-write) on a cache line no other thread
+ * writes. The exporter reads them concurrently with relaxed loads.
+ * Latencies go into power-of-two buckets split four ways (within 25%).
+ */
+class alignas(64) TelemetrySlot {
+public:
+    static constexpr int kLatencyBuckets = 8 + 38 * 4;   // Up to ~2^40 ns
+
+private:
+    std::atomic<uint64_t> produced_{0};
+    std::atomic<uint64_t> consumed_{0};
+    std::atomic<double> notional_{0.0};     // Σ price * volume of consumed ticks
+    std::atomic<double> volume_{0.0};       // Σ volume of consumed ticks
+    std::atomic<uint64_t> latency_ns_[kLatencyBuckets] = {};
+    std::atomic<bool> in_use_{false};
+
+    template<typename V>
+    static void bump(std::atomic<V>& counter, V delta) {
+        counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    friend class TelemetryRegistry;
+
+public:
+    static int latencyBucket(uint64_t ns) {
+        if (ns < 8) return static_cast<int>(ns);
+        int msb = 63 - __builtin_clzll(ns);
+        if (msb > 40) return kLatencyBuckets - 1;
+        return 8 + (msb - 3) * 4 + static_cast<int>((ns >> (msb - 2)) & 3);
+    }
+
+    static uint64_t latencyBucketLow(int index) {
+        if (index < 8) return static_cast<uint64_t>(index);
+        int msb = (index - 8) / 4 + 3;
+        return (uint64_t(1) << msb) + (static_cast<uint64_t>((index - 8) % 4) << (msb - 2));
+    }
+
+    /**
+     * @brief Producer side: ticks pushed
+     */
+    void addProduced(uint64_t n = 1) { bump(produced_, n); }
+
+    /**
+     * @brief Consumer side: one processed tick
+     */
+    void recordTick(uint64_t latency_ns, double price, int volume) {
+        bump(consumed_, uint64_t(1));
+        bump(notional_, price * volume);
+        bump(volume_, static_cast<double>(volume));
+        bump(latency_ns_[latencyBucket(latency_ns)], uint64_t(1));
+    }
+};
+
+/**
+ * @brief Point-in-time totals across all slots
+ */
+struct TelemetrySnapshot {
+    uint64_t produced = 0;
+    uint64_t consumed = 0;
+    double notional = 0.0;
+    double volume = 0.0;
+    size_t active_threads = 0;
+    uint64_t latency_ns[TelemetrySlot::kLatencyBuckets] = {};
+    uint64_t timestamp_ns = 0;
+
+    /**
+     * @brief Latency percentile (ns) of ticks consumed since an earlier snapshot; NaN if none
+     */
+    double windowPercentileNanos(const TelemetrySnapshot& earlier, double percentile) const;
+};
+
+/**
+ * @brief Fixed pool of per-thread telemetry slots
+ *
+ * Threads acquire a slot when they start and release it when they stop.
+ * Released slots keep their counts and are reused by later threads, so
+ * totals stay monotonic across runs as Prometheus counters must.
+ */
+class TelemetryRegistry {
+public:
+    static constexpr size_t kMaxSlots = 64;
+
+private:
+    TelemetrySlot slots_[kMaxSlots];
+
+public:
+    TelemetryRegistry() = default;
+
+    // Disable copy and move
+    TelemetryRegistry(const TelemetryRegistry&) = delete;
+    TelemetryRegistry& operator=(const TelemetryRegistry&) = delete;
+
+    /**
+     * @brief Claim a slot for the calling thread
+     * @return nullptr if all slots are in use (telemetry is then skipped)
+     */
+    TelemetrySlot* acquire();
+
+    /**
+     * @brief Return a slot; its counts remain part of the totals
+     */
+    void release(TelemetrySlot* slot);
+
+    /**
+     * @brief Sum all slots
+     */
+    TelemetrySnapshot snapshot() const;
+};
+
+/**
+ * @brief Render a Prometheus text-format exposition
+ * @param current Latest snapshot
+ * @param previous Snapshot from the previous interval (rates and window P50/P99)
+ */
+std::string renderPrometheus(const TelemetrySnapshot& current, const TelemetrySnapshot& previous);
+
+/**
+ * @brief Where and how often the exporter publishes
+ */
+struct TelemetryConfig {
+    std::string file_path;      // Rewritten atomically each interval; empty = off
+    std::string socket_path;    // Unix stream socket; each connection gets the latest text; empty = off
+    std::chrono::milliseconds interval{1000};
+};
+
+/**
+ * @brief Background thread that aggregates a registry and serves Prometheus text
+ *
+ * Every interval it snapshots the registry, renders the exposition and
+ * rewrites the file (write to PATH.tmp, then rename) and/or keeps it ready
+ * for the socket, where a connecting client (e.g. `socat - UNIX:PATH`)
+ * receives the latest text and the connection is closed. Pipeline threads
+ * never block on the exporter.
+ */
+class TelemetryExporter {
+private:
+    TelemetryRegistry& registry_;
+    TelemetryConfig config_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    int listen_fd_;
+    mutable std::mutex text_mutex_;
+    std::string latest_;
+    std::atomic<uint64_t> publications_;
+    std::string error_;
+
+    void run();
+    void publish(TelemetrySnapshot& previous);
+    void serveClients(int timeout_ms);
+
+public:
+    TelemetryExporter(TelemetryRegistry& registry, const TelemetryConfig& config);
+    ~TelemetryExporter();
+
+    // Disable copy and move
+    TelemetryExporter(const TelemetryExporter&) = delete;
+    TelemetryExporter& operator=(const TelemetryExporter&) = delete;
+
+    /**
+     * @brief Bind the socket (if configured) and start the thread
+     * @return false if the socket could not be created (see getError())
+     */
+    bool start();
+
+    /**
+     * @brief Publish once more and stop; removes the socket file
+     */
+    void stop();
+
+    /**
+     * @brief Most recently rendered exposition
+     */
+    std::string latest() const;
+
+    /**
+     * @brief Number of intervals published so far
+     */
+    uint64_t getPublications() const { return publications_.load(); }
+
+    const std::string& getError() const { return error_; }
+};
+
+} // namespace market
+
+#endif // TELEMETRY_H
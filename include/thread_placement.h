@@ -0,0 +1,116 @@
+#ifndef THREAD_PLACEMENT_H
+#define THREAD_PLACEMENT_H
+
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+/**
+ * @brief Pin the calling thread to a single CPU
+ * @param cpu CPU index; negative leaves the thread unpinned
+ * @return true if pinned (or nothing was requested), false if the kernel refused
+ */
+inline bool pinCurrentThread(int cpu) {
+    if (cpu < 0) return true;
+    if (cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+/**
+ * @brief Switch the calling thread to SCHED_FIFO at the given priority
+ * @param priority 1-99; 0 leaves the thread on the default scheduler
+ * @return true on success (or nothing was requested); needs CAP_SYS_NICE
+ */
+bool setRealtimePriority(int priority);
+
+/**
+ * @brief Prefer allocating the calling thread's future pages on a NUMA node
+ *
+ * Uses MPOL_PREFERRED, so allocation falls back to other nodes when the
+ * preferred one is full. Applied to the thread that allocates queue
+ * storage (the producer, for the linked-list queue), it keeps that storage
+ * local to the chosen node.
+ *
+ * @param node NUMA node; negative leaves the default (first-touch) policy
+ * @return true on success (or nothing was requested)
+ */
+bool preferMemoryNode(int node);
+
+/**
+ * @brief Bind an existing mapping (e.g. a queue ring buffer) to a NUMA node
+ * @return true on success; pages already faulted in elsewhere are migrated
+ */
+bool bindMemoryToNode(void* addr, size_t length, int node);
+
+/**
+ * @brief Where one logical CPU sits in the machine
+ */
+struct CpuInfo {
+    int cpu = -1;
+    int core_id = -1;       // Physical core within the package
+    int package_id = -1;    // Socket
+    int numa_node = -1;
+};
+
+/**
+ * @brief Logical CPUs this process may run on, with their core/socket/node
+ *
+ * Read from /sys/devices/system/cpu; CPUs outside the process affinity mask
+ * (e.g. isolated with isolcpus and not granted to us) are left out.
+ */
+class CpuTopology {
+private:
+    std::vector<CpuInfo> cpus_;
+
+public:
+    /**
+     * @brief Read topology from sysfs for the CPUs in our affinity mask
+     */
+    static CpuTopology discover();
+
+    /**
+     * @brief Get usable CPUs
+     */
+    const std::vector<CpuInfo>& getCpus() const { return cpus_; }
+
+    /**
+     * @brief Look up a CPU; nullptr if not usable
+     */
+    const CpuInfo* find(int cpu) const;
+
+    /**
+     * @brief Two hyperthreads of the same physical core
+     * @return false if SMT is off or unavailable
+     */
+    bool findSiblingPair(int& first, int& second) const;
+
+    /**
+     * @brief Two different physical cores in the same package
+     */
+    bool findSameSocketPair(int& first, int& second) const;
+
+    /**
+     * @brief Two cores in different packages
+     */
+    bool findCrossSocketPair(int& first, int& second) const;
+
+    /**
+     * @brief Number of distinct packages among usable CPUs
+     */
+    size_t getPackageCount() const;
+
+    /**
+     * @brief One line per CPU: "cpu N: core C, package P, node M"
+     */
+    std::string describe() const;
+};
+
+} // namespace benchmark
+
+#endif // THREAD_PLACEMENT_H
@@ -0,0 +1,95 @@
+#ifndef TICK_BATCH_H
+#define TICK_BATCH_H
+
+#include "market_tick.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace market {
+
+/**
+ * @brief Structure-of-arrays batch of ticks for vectorized analytics
+ *
+ * Each field is stored in its own contiguous array so batch kernels can
+ * load several prices, volumes or sides per instruction. The symbol is not
+ * stored; a batch is assumed to belong to a single instrument.
+ */
+class TickBatch {
+private:
+    std::vector<double> prices_;
+    std::vector<int32_t> volumes_;
+    std::vector<char> sides_;
+    std::vector<uint64_t> timestamps_;
+
+public:
+    /**
+     * @brief Constructor
+     * @param capacity Number of ticks to reserve up front
+     */
+    explicit TickBatch(size_t capacity = 1024) { reserve(capacity); }
+
+    /**
+     * @brief Reserve storage for at least capacity ticks
+     */
+    void reserve(size_t capacity) {
+        prices_.reserve(capacity);
+        volumes_.reserve(capacity);
+        sides_.reserve(capacity);
+        timestamps_.reserve(capacity);
+    }
+
+    /**
+     * @brief Append a tick
+     */
+    void push_back(const MarketTick& tick) {
+        push_back(tick.price, tick.volume, tick.side, tick.timestamp_ns);
+    }
+
+    /**
+     * @brief Append raw tick fields
+     */
+    void push_back(double price, int32_t volume, char side, uint64_t timestamp_ns) {
+        prices_.push_back(price);
+        volumes_.push_back(volume);
+        sides_.push_back(side);
+        timestamps_.push_back(timestamp_ns);
+    }
+
+    /**
+     * @brief Resize all columns (new entries are zeroed)
+     */
+    void resize(size_t count) {
+        prices_.resize(count);
+        volumes_.resize(count);
+        sides_.resize(count);
+        timestamps_.resize(count);
+    }
+
+    /**
+     * @brief Remove all ticks (keeps capacity)
+     */
+    void clear() {
+        prices_.clear();
+        volumes_.clear();
+        sides_.clear();
+        timestamps_.clear();
+    }
+
+    size_t size() const { return prices_.size(); }
+    bool empty() const { return prices_.empty(); }
+
+    const double* prices() const { return prices_.data(); }
+    const int32_t* volumes() const { return volumes_.data(); }
+    const char* sides() const { return sides_.data(); }
+    const uint64_t* timestamps() const { return timestamps_.data(); }
+
+    double* prices() { return prices_.data(); }
+    int32_t* volumes() { return volumes_.data(); }
+    char* sides() { return sides_.data(); }
+    uint64_t* timestamps() { return timestamps_.data(); }
+};
+
+} // namespace market
+
+#endif // TICK_BATCH_H
@@ -2,6 +2,8 @@
 #define TICK_GENERATOR_H
 
 #include "market_tick.h"
+#include "tick_batch.h"
+#include "fast_rng.h"
 #include <vector>
 #include <random>
 #include <string>
@@ -28,6 +30,23 @@ private:
     std::uniform_real_distribution<double> price_dist_;
     std::uniform_int_distribution<int> volume_dist_;
     std::uniform_int_distribution<int> side_dist_;
+    Xoshiro256PlusPlus fast_rng_;              // Fast-mode single stream
+    Xoshiro256PlusPlusLanes<8> batch_rng_;     // Fast-mode batch streams
+    uint32_t volume_range_;                    // max_volume - min_volume + 1
+    
+    /**
+     * @brief Decode one 64-bit draw into price step, volume and side
+     *
+     * Low 32 bits give the price step, the high 32 bits the volume
+     * (multiply-shift) and their lowest bit the side, with no branches.
+     */
+    void decodeDraw(uint64_t draw, double& step, int32_t& volume, char& side) const {
+        uint32_t lo = static_cast<uint32_t>(draw);
+        uint32_t hi = static_cast<uint32_t>(draw >> 32);
+        step = (unitRandom(lo) * 2.0 - 1.0) * price_step_;
+        volume = min_volume_ + static_cast<int32_t>(boundedRandom(hi, volume_range_));
+        side = static_cast<char>('B' + (hi & 1) * ('S' - 'B'));
+    }
     
 public:
     /**
@@ -59,6 +78,29 @@ public:
      */
     std::vector<MarketTick> generateTicks(size_t count);
     
+    /**
+     * @brief Generate a single tick using the fast xoshiro256++ path
+     *
+     * Same random walk as generateTick(), but one 64-bit draw supplies the
+     * price step, volume and side instead of three distribution calls.
+     *
+     * @param timestamp_ns Timestamp to stamp; 0 reads the clock
+     * @return MarketTick Generated tick
+     */
+    MarketTick generateTickFast(uint64_t timestamp_ns = 0);
+    
+    /**
+     * @brief Generate ticks into a structure-of-arrays batch (fast path)
+     *
+     * Draws come from 8 lockstep xoshiro256++ lanes, so the random and
+     * decode steps vectorise; only the price prefix sum is sequential.
+     *
+     * @param batch Destination, resized to count
+     * @param count Number of ticks to generate
+     * @param single_timestamp Read the clock once per batch instead of per tick
+     */
+    void generateBatch(TickBatch& batch, size_t count, bool single_timestamp = true);
+    
     /**
      * @brief Get current price
      * @return double Current price
@@ -0,0 +1,219 @@
+#include "benchmark.h"
+#include "benchmark_runner.h"
+#include "benchmark_report.h"
+#include "analytics.h"
+#include "lockfree_queue.h"
+#include "memory_arena.h"
+#include "mutex_queue.h"
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+/**
+ * @brief A memory resource for one run plus the arena behind it, if any
+ */
+struct OwnedResource {
+    std::unique_ptr<market::MemoryArena> arena;
+    std::unique_ptr<std::pmr::memory_resource> resource;
+    std::pmr::memory_resource* shared = nullptr;    // Used when nothing is owned
+
+    std::pmr::memory_resource* get() const {
+        if (resource) return resource.get();
+        return shared ? shared : std::pmr::get_default_resource();
+    }
+};
+
+using ResourceFactory = std::function<OwnedResource(size_t num_ticks)>;
+
+/**
+ * @brief Installs a default pmr resource for the lifetime of the scope
+ *
+ * runBenchmark default-constructs its queue, and a default-constructed
+ * polymorphic_allocator picks up the default resource.
+ */
+class ScopedDefaultResource {
+private:
+    std::pmr::memory_resource* previous_;
+
+public:
+    explicit ScopedDefaultResource(std::pmr::memory_resource* resource)
+        : previous_(std::pmr::set_default_resource(resource)) {}
+    ~ScopedDefaultResource() { std::pmr::set_default_resource(previous_); }
+
+    ScopedDefaultResource(const ScopedDefaultResource&) = delete;
+    ScopedDefaultResource& operator=(const ScopedDefaultResource&) = delete;
+};
+
+/**
+ * @brief Arena sized for every node of one run (nothing is reused)
+ */
+OwnedResource arenaFor(size_t bytes) {
+    OwnedResource owned;
+    owned.arena.reset(new market::MemoryArena(bytes));
+    owned.resource.reset(new market::ArenaResource(*owned.arena));
+    return owned;
+}
+
+/**
+ * @brief One warmup and `repetitions` measured runBenchmark runs, each with a fresh resource
+ */
+template<typename QueueType>
+BenchmarkSummary measureAllocator(const std::string& queue, const std::string& allocator, size_t num_ticks,
+                                  size_t repetitions, const ResourceFactory& factory) {
+    const std::string label = queue + " / " + allocator;
+    std::vector<BenchmarkResults> runs;
+    for (size_t r = 0; r <= repetitions; r++) {
+        OwnedResource owned = factory ? factory(num_ticks) : OwnedResource();
+        ScopedDefaultResource scope(owned.get());
+        BenchmarkResults result = runBenchmark<QueueType>(label, num_ticks);
+        if (r > 0) runs.push_back(result);
+    }
+    return BenchmarkSummary::fromRuns(queue, num_ticks, runs);
+}
+
+void printSummaryTable(const std::string& title, const std::vector<BenchmarkSummary>& summaries) {
+    std::cout << "\n" << title << std::endl;
+    std::cout << "  " << std::left << std::setw(46) << "Queue / allocator" << std::right
+              << std::setw(14) << "Ticks/s" << std::setw(12) << "P50 (μs)" << std::setw(12) << "P99 (μs)"
+              << std::endl;
+    for (const auto& s : summaries) {
+        std::cout << "  " << std::left << std::setw(46) << s.name << std::right << std::fixed
+                  << std::setprecision(0) << std::setw(14) << s.throughput_tps.median
+                  << std::setprecision(2) << std::setw(11) << s.latency_p50.median
+                  << std::setw(11) << s.latency_p99.median << std::endl;
+    }
+}
+
+/**
+ * @brief Nanoseconds per addTick() for a rolling average built with the given allocator
+ */
+template<typename Calculator>
+double measureRollingAverage(Calculator& calc, const std::vector<market::MarketTick>& ticks, size_t rounds) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < rounds; r++) {
+        for (const auto& tick : ticks) calc.addTick(tick);
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (calc.getAverage() < 0.0) std::cout << calc.getAverage();    // Keep the work observable
+    return std::chrono::duration<double, std::nano>(end - start).count() / (ticks.size() * rounds);
+}
+
+void reportRollingAverage() {
+    const size_t rounds = 50;
+    std::vector<market::MarketTick> ticks(100000);
+    for (size_t i = 0; i < ticks.size(); i++) {
+        ticks[i].price = 100.0 + static_cast<double>(i % 977) * 0.01;
+    }
+
+    std::cout << "\nRollingAverageCalculator::addTick (" << ticks.size() * rounds << " ticks)" << std::endl;
+    std::cout << "  " << std::left << std::setw(34) << "Allocator" << std::right
+              << std::setw(12) << "w=100" << std::setw(12) << "w=10000" << std::endl;
+
+    const size_t windows[] = {100, 10000};
+    double results[3][2];
+    for (int w = 0; w < 2; w++) {
+        {
+            market::RollingAverageCalculator calc(windows[w]);
+            results[0][w] = measureRollingAverage(calc, ticks, rounds);
+        }
+        {
+            std::pmr::unsynchronized_pool_resource pool;
+            market::pmr::RollingAverageCalculator calc(windows[w], &pool);
+            results[1][w] = measureRollingAverage(calc, ticks, rounds);
+        }
+        {
+            market::MemoryArena arena(16 * 1024 * 1024);
+            market::ArenaResource arena_resource(arena);
+            std::pmr::unsynchronized_pool_resource pool(&arena_resource);
+            market::pmr::RollingAverageCalculator calc(windows[w], &pool);
+            results[2][w] = measureRollingAverage(calc, ticks, rounds);
+        }
+    }
+
+    const char* labels[] = {"std::allocator", "pmr unsynchronized pool", "pmr pool over arena"};
+    for (int i = 0; i < 3; i++) {
+        std::cout << "  " << std::left << std::setw(34) << labels[i] << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(9) << results[i][0] << " ns"
+                  << std::setw(9) << results[i][1] << " ns" << std::endl;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Compare std::allocator, pmr pools, monotonic buffers and the memory arena under runBenchmark
+ */
+void runAllocatorBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Allocator Comparison - Queues and Analytics" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const size_t num_ticks = 200000;
+    const size_t repetitions = 3;
+    // Upper bound on one SPSCQueue node (tick plus next pointer, padded)
+    const size_t node_bytes = sizeof(market::MarketTick) + 16;
+
+    using SPSC = lockfree::SPSCQueue<market::MarketTick>;
+    using PmrSPSC = lockfree::pmr::SPSCQueue<market::MarketTick>;
+    using Mutex = lockfree::MutexQueue<market::MarketTick>;
+    using PmrMutex = lockfree::pmr::MutexQueue<market::MarketTick>;
+
+    std::vector<BenchmarkSummary> spsc;
+    spsc.push_back(measureAllocator<SPSC>("lockfree", "std::allocator", num_ticks, repetitions, nullptr));
+    spsc.push_back(measureAllocator<PmrSPSC>("lockfree", "pmr new_delete_resource", num_ticks, repetitions,
+        [](size_t) {
+            OwnedResource owned;
+            owned.shared = std::pmr::new_delete_resource();
+            return owned;
+        }));
+    spsc.push_back(measureAllocator<PmrSPSC>("lockfree", "pmr synchronized pool", num_ticks, repetitions,
+        [](size_t) {
+            OwnedResource owned;
+            owned.resource.reset(new std::pmr::synchronized_pool_resource());
+            return owned;
+        }));
+    spsc.push_back(measureAllocator<PmrSPSC>("lockfree", "pmr monotonic buffer", num_ticks, repetitions,
+        [node_bytes](size_t n) {
+            OwnedResource owned;
+            owned.resource.reset(new std::pmr::monotonic_buffer_resource((n + 1) * node_bytes));
+            return owned;
+        }));
+    spsc.push_back(measureAllocator<PmrSPSC>("lockfree", "pmr arena (huge pages, prefaulted)", num_ticks, repetitions,
+        [node_bytes](size_t n) { return arenaFor((n + 1) * node_bytes + 4096); }));
+
+    std::vector<BenchmarkSummary> mutex;
+    mutex.push_back(measureAllocator<Mutex>("mutex", "std::allocator", num_ticks, repetitions, nullptr));
+    mutex.push_back(measureAllocator<PmrMutex>("mutex", "pmr unsynchronized pool", num_ticks, repetitions,
+        [](size_t) {
+            OwnedResource owned;
+            owned.resource.reset(new std::pmr::unsynchronized_pool_resource());
+            return owned;
+        }));
+    mutex.push_back(measureAllocator<PmrMutex>("mutex", "pmr arena (huge pages, prefaulted)", num_ticks, repetitions,
+        [](size_t n) { return arenaFor(2 * n * sizeof(market::MarketTick) + (1 << 20)); }));
+
+    std::cout << "\n" << num_ticks << " ticks, median of " << repetitions << " runs after one warmup"
+              << std::endl;
+    printSummaryTable("Lock-free SPSC (one node allocation per push):", spsc);
+    printSummaryTable("Mutex queue (std::deque chunks):", mutex);
+
+    reportRollingAverage();
+
+    std::vector<BenchmarkResults> all_results;
+    for (const auto* group : {&spsc, &mutex}) {
+        for (const auto& s : *group) all_results.insert(all_results.end(), s.runs.begin(), s.runs.end());
+    }
+    BenchmarkResults::exportToCSV(all_results, "allocator_benchmark_results.csv");
+    std::cout << "\nResults exported to: allocator_benchmark_results.csv" << std::endl;
+}
+
+} // namespace benchmark
@@ -0,0 +1,365 @@
+#include "benchmark.h"
+#include "analytics.h"
+#include "analytics_pipeline.h"
+#include "bar_aggregator.h"
+#include "rolling_extrema.h"
+#include "lockfree_queue.h"
+#include "simd_kernels.h"
+#include "tick_batch.h"
+#include "tick_generator.h"
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double nanosPerTick(Clock::time_point start, Clock::time_point end, size_t ticks) {
+    return std::chrono::duration<double, std::nano>(end - start).count() / ticks;
+}
+
+double relativeDiff(double a, double b) {
+    double scale = std::fabs(a) > std::fabs(b) ? std::fabs(a) : std::fabs(b);
+    return scale == 0.0 ? 0.0 : std::fabs(a - b) / scale;
+}
+
+std::vector<market::TickBatch> splitIntoBatches(const std::vector<market::MarketTick>& ticks,
+                                                size_t batch_size) {
+    std::vector<market::TickBatch> batches;
+    for (size_t i = 0; i < ticks.size(); i += batch_size) {
+        market::TickBatch batch(batch_size);
+        for (size_t j = i; j < ticks.size() && j < i + batch_size; j++) {
+            batch.push_back(ticks[j]);
+        }
+        batches.push_back(std::move(batch));
+    }
+    return batches;
+}
+
+/**
+ * @brief Compare per-tick calculators against SoA batch kernels
+ */
+void benchmarkBatchKernels(const std::vector<market::MarketTick>& ticks) {
+    const size_t n = ticks.size();
+    const size_t window = 100;
+
+    std::cout << "\n--- SIMD batch kernels (" << n << " ticks, best kernel: "
+              << market::simd::kernels().name << ") ---" << std::endl;
+
+    // Reference: the three per-tick calculators behind AnalyticsEngine
+    market::VWAPCalculator ref_vwap;
+    market::TradeImbalanceCalculator ref_imbalance;
+    market::RollingAverageCalculator ref_avg(window);
+    auto t0 = Clock::now();
+    for (const auto& tick : ticks) {
+        ref_vwap.addTick(tick);
+        ref_imbalance.addTick(tick);
+        ref_avg.addTick(tick);
+    }
+    auto t1 = Clock::now();
+    std::cout << "  Per-tick calculators:      " << std::fixed << std::setprecision(2)
+              << nanosPerTick(t0, t1, n) << " ns/tick" << std::endl;
+
+    const market::simd::KernelLevel levels[] = {
+        market::simd::KernelLevel::Scalar,
+        market::simd::KernelLevel::AVX2,
+        market::simd::KernelLevel::AVX512
+    };
+    const size_t batch_sizes[] = {64, 1024};
+
+    for (size_t batch_size : batch_sizes) {
+        auto batches = splitIntoBatches(ticks, batch_size);
+        for (auto level : levels) {
+            if (!market::simd::isSupported(level)) continue;
+            const auto& k = market::simd::kernelsFor(level);
+
+            market::VWAPCalculator vwap;
+            market::TradeImbalanceCalculator imbalance;
+            market::RollingAverageCalculator avg(window);
+            auto b0 = Clock::now();
+            for (const auto& batch : batches) {
+                auto sums = k.batch_sums(batch.prices(), batch.volumes(), batch.sides(), batch.size());
+                vwap.addSums(sums.price_volume, sums.volume);
+                imbalance.addVolumes(sums.buy_volume, sums.sell_volume);
+                avg.addBatch(batch.prices(), batch.size(), k);
+            }
+            auto b1 = Clock::now();
+
+            bool volumes_exact = vwap.getTotalVolume() == ref_vwap.getTotalVolume() &&
+                                 imbalance.getBuyVolume() == ref_imbalance.getBuyVolume() &&
+                                 imbalance.getSellVolume() == ref_imbalance.getSellVolume();
+            std::cout << "  Batch " << std::setw(4) << batch_size << " " << std::setw(7) << k.name << ":  "
+                      << std::setprecision(2) << nanosPerTick(b0, b1, n) << " ns/tick"
+                      << " | volumes " << (volumes_exact ? "exact" : "MISMATCH")
+                      << " | VWAP rel diff " << std::scientific << std::setprecision(1)
+                      << relativeDiff(vwap.getVWAP(), ref_vwap.getVWAP())
+                      << " | rolling avg rel diff "
+                      << relativeDiff(avg.getAverage(), ref_avg.getAverage())
+                      << std::fixed << std::endl;
+        }
+    }
+
+    // Full engine, including the rolling quantile sketch
+    market::AnalyticsEngine tick_engine(window);
+    auto e0 = Clock::now();
+    for (const auto& tick : ticks) tick_engine.processTick(tick);
+    auto e1 = Clock::now();
+
+    auto batches = splitIntoBatches(ticks, 1024);
+    market::AnalyticsEngine batch_engine(window);
+    auto e2 = Clock::now();
+    for (const auto& batch : batches) batch_engine.processBatch(batch);
+    auto e3 = Clock::now();
+
+    std::cout << "  AnalyticsEngine processTick:  " << std::setprecision(2)
+              << nanosPerTick(e0, e1, n) << " ns/tick" << std::endl;
+    std::cout << "  AnalyticsEngine processBatch: " << nanosPerTick(e2, e3, n) << " ns/tick"
+              << " (VWAP rel diff " << std::scientific << std::setprecision(1)
+              << relativeDiff(tick_engine.getVWAP(), batch_engine.getVWAP()) << ")"
+              << std::fixed << std::endl;
+}
+
+/**
+ * @brief Time one calculator's addTick over the whole stream
+ */
+template<typename Calculator>
+double timeCalculator(Calculator& calc, const std::vector<market::MarketTick>& ticks) {
+    auto t0 = Clock::now();
+    for (const auto& tick : ticks) calc.addTick(tick);
+    auto t1 = Clock::now();
+    return nanosPerTick(t0, t1, ticks.size());
+}
+
+/**
+ * @brief Per-tick cost of the online statistics calculators
+ */
+void benchmarkOnlineStatistics(const std::vector<market::MarketTick>& ticks) {
+    std::cout << "\n--- Online statistics (" << ticks.size() << " ticks) ---" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    market::EWMACalculator ewma(0.05);
+    std::cout << "  EWMA price/variance:     " << timeCalculator(ewma, ticks) << " ns/tick"
+              << " (EWMA " << ewma.getMean() << ", vol " << std::setprecision(5) << ewma.getStdDev()
+              << ")" << std::setprecision(2) << std::endl;
+
+    market::RealizedVolatilityCalculator realized;
+    std::cout << "  Realized volatility:     " << timeCalculator(realized, ticks) << " ns/tick"
+              << " (RV " << std::setprecision(5) << realized.getRealizedVolatility()
+              << ")" << std::setprecision(2) << std::endl;
+
+    market::RollingStdDevCalculator rolling_std(100);
+    std::cout << "  Rolling stddev (100):    " << timeCalculator(rolling_std, ticks) << " ns/tick"
+              << " (stddev " << std::setprecision(5) << rolling_std.getStdDev()
+              << ")" << std::setprecision(2) << std::endl;
+
+    // Check the windowed Welford against a two-pass recomputation of the last window
+    double mean = 0.0;
+    size_t w = rolling_std.getCount();
+    for (size_t i = ticks.size() - w; i < ticks.size(); i++) mean += ticks[i].price;
+    mean /= w;
+    double m2 = 0.0;
+    for (size_t i = ticks.size() - w; i < ticks.size(); i++) {
+        m2 += (ticks[i].price - mean) * (ticks[i].price - mean);
+    }
+    std::cout << "  Rolling stddev vs two-pass rel diff: " << std::scientific << std::setprecision(1)
+              << relativeDiff(rolling_std.getStdDev(), std::sqrt(m2 / (w - 1))) << std::fixed << std::endl;
+}
+
+/**
+ * @brief Rolling min/max via monotonic ring buffers vs rescanning the window
+ */
+void benchmarkRollingExtrema(const std::vector<market::MarketTick>& ticks) {
+    const size_t n = ticks.size();
+    std::cout << "\n--- Rolling min/max (" << n << " ticks) ---" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+
+    const size_t windows[] = {100, 1000, 10000};
+    for (size_t window : windows) {
+        market::RollingMinMaxCalculator extrema(window);
+        double ns_mono = timeCalculator(extrema, ticks);
+
+        std::cout << "  Count window " << std::setw(5) << window << ": monotonic "
+                  << ns_mono << " ns/tick";
+
+        // Naive: keep the window and rescan it on every tick (too slow beyond 1000)
+        if (window <= 1000) {
+            std::deque<double> prices;
+            double naive_max = 0.0;
+            double naive_min = 0.0;
+            auto t0 = Clock::now();
+            for (const auto& tick : ticks) {
+                prices.push_back(tick.price);
+                if (prices.size() > window) prices.pop_front();
+                auto mm = std::minmax_element(prices.begin(), prices.end());
+                naive_min = *mm.first;
+                naive_max = *mm.second;
+            }
+            auto t1 = Clock::now();
+
+            bool match = naive_max == extrema.getMax() && naive_min == extrema.getMin();
+            std::cout << ", rescan " << nanosPerTick(t0, t1, n) << " ns/tick"
+                      << " | " << (match ? "match" : "MISMATCH");
+        }
+        std::cout << std::endl;
+    }
+
+    // Synthetic 1us spacing so windows hold a predictable number of ticks
+    std::vector<market::MarketTick> timed = ticks;
+    for (size_t i = 0; i < timed.size(); i++) timed[i].timestamp_ns = 1000 * (i + 1);
+
+    const uint64_t time_windows_ns[] = {100000, 1000000};
+    for (uint64_t window_ns : time_windows_ns) {
+        market::TimeRollingMinMaxCalculator extrema(window_ns, 4096);
+        double ns_mono = timeCalculator(extrema, timed);
+        std::cout << "  Time window " << std::setw(7) << window_ns / 1000 << "us: monotonic "
+                  << ns_mono << " ns/tick (range " << std::setprecision(4) << extrema.getRange()
+                  << ")" << std::setprecision(2) << std::endl;
+    }
+}
+
+/**
+ * @brief Stateless calculator used to check the empty-base optimisation
+ */
+struct NoOpCalculator {
+    void addTick(const market::MarketTick&) {}
+    void reset() {}
+};
+
+/**
+ * @brief Compile-time pipelines with 1 and 10 metrics vs AnalyticsEngine
+ */
+void benchmarkPipelines(const std::vector<market::MarketTick>& ticks) {
+    using OneMetric = market::AnalyticsPipeline<market::VWAPCalculator>;
+    using TenMetrics = market::AnalyticsPipeline<
+        market::VWAPCalculator,
+        market::TradeImbalanceCalculator,
+        market::RollingAverageCalculator,
+        market::EWMACalculator,
+        market::RealizedVolatilityCalculator,
+        market::RollingStdDevCalculator,
+        market::RollingMinMaxCalculator,
+        market::TimeRollingMinMaxCalculator,
+        market::RollingQuantileCalculator,
+        market::TickCounter>;
+    using WithEmpty = market::AnalyticsPipeline<market::VWAPCalculator, NoOpCalculator>;
+
+    std::cout << "\n--- Analytics pipelines (" << ticks.size() << " ticks) ---" << std::endl;
+    std::cout << "  sizeof(VWAPCalculator) = " << sizeof(market::VWAPCalculator)
+              << ", sizeof(Pipeline<VWAP, NoOp>) = " << sizeof(WithEmpty) << std::endl;
+
+    OneMetric one;
+    TenMetrics ten;
+    market::AnalyticsEngine engine;
+
+    auto t0 = Clock::now();
+    for (const auto& tick : ticks) one.processTick(tick);
+    auto t1 = Clock::now();
+    for (const auto& tick : ticks) ten.processTick(tick);
+    auto t2 = Clock::now();
+    for (const auto& tick : ticks) engine.processTick(tick);
+    auto t3 = Clock::now();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Pipeline, " << OneMetric::size() << " metric:    " << nanosPerTick(t0, t1, ticks.size())
+              << " ns/tick (VWAP " << one.get<market::VWAPCalculator>().getVWAP() << ")" << std::endl;
+    std::cout << "  Pipeline, " << TenMetrics::size() << " metrics:  " << nanosPerTick(t1, t2, ticks.size())
+              << " ns/tick (VWAP " << ten.get<market::VWAPCalculator>().getVWAP() << ")" << std::endl;
+    std::cout << "  AnalyticsEngine:       " << nanosPerTick(t2, t3, ticks.size())
+              << " ns/tick (VWAP " << engine.getVWAP() << ")" << std::endl;
+}
+
+/**
+ * @brief Build an interleaved multi-symbol stream with synthetic timestamps
+ * @param spacing_ns Time between consecutive ticks across all symbols
+ */
+std::vector<market::MarketTick> makeMultiSymbolTicks(size_t count, size_t num_symbols,
+                                                     uint64_t spacing_ns) {
+    std::vector<market::TickGenerator> generators;
+    generators.reserve(num_symbols);
+    for (size_t s = 0; s < num_symbols; s++) {
+        std::string symbol = "S" + std::to_string(s);
+        generators.emplace_back(symbol, 100.0 + s % 50, 0.01, 100, 1000, static_cast<unsigned int>(s + 1));
+    }
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<size_t> pick(0, num_symbols - 1);
+    const uint64_t base_ns = 1700000000ULL * 1000000000ULL;
+
+    std::vector<market::MarketTick> ticks;
+    ticks.reserve(count);
+    for (size_t i = 0; i < count; i++) {
+        market::MarketTick tick = generators[pick(rng)].generateTick();
+        tick.timestamp_ns = base_ns + i * spacing_ns;
+        ticks.push_back(tick);
+    }
+    return ticks;
+}
+
+/**
+ * @brief Per-tick cost of building OHLCV bars across many symbols
+ */
+void benchmarkBarAggregator() {
+    const size_t n = 1000000;
+    const uint64_t second = 1000000000ULL;
+    const size_t symbol_counts[] = {100, 1000, 5000};
+
+    std::cout << "\n--- OHLCV bar aggregation (" << n << " ticks) ---" << std::endl;
+
+    for (size_t num_symbols : symbol_counts) {
+        // 500us spacing: 1M ticks span ~500s, so 5m bars roll at least once
+        auto ticks = makeMultiSymbolTicks(n, num_symbols, 500000);
+
+        const std::vector<std::vector<uint64_t>> configs = {
+            {second},
+            {second, 60 * second, 300 * second}
+        };
+        for (const auto& intervals : configs) {
+            lockfree::SPSCQueue<market::OHLCVBar> bars;
+            market::BarAggregator aggregator(intervals, bars, num_symbols);
+
+            auto t0 = Clock::now();
+            for (const auto& tick : ticks) aggregator.addTick(tick);
+            auto t1 = Clock::now();
+            aggregator.flush();
+
+            size_t drained = 0;
+            while (bars.pop()) drained++;
+
+            std::cout << "  " << std::setw(5) << num_symbols << " symbols, " << intervals.size()
+                      << " interval(s): " << std::fixed << std::setprecision(2)
+                      << nanosPerTick(t0, t1, n) << " ns/tick, " << drained << " bars" << std::endl;
+        }
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Measure per-tick cost of analytics calculators and batch kernels
+ */
+void runAnalyticsBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Analytics - Per-Tick Cost" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const size_t n = 1000000;
+    market::TickGenerator generator("SPY", 100.0, 0.01, 100, 1000, 42);
+    std::vector<market::MarketTick> ticks = generator.generateTicks(n);
+
+    benchmarkBatchKernels(ticks);
+    benchmarkOnlineStatistics(ticks);
+    benchmarkRollingExtrema(ticks);
+    benchmarkPipelines(ticks);
+    benchmarkBarAggregator();
+}
+
+} // namespace benchmark
@@ -0,0 +1,231 @@
+#include "benchmark.h"
+#include "analytics.h"
+#include "fast_rng.h"
+#include "market_tick.h"
+#include "memory_arena.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kSymbols = 16384;
+constexpr size_t kRingTicks = size_t(1) << 21;    // 64 MB of CompactTicks
+constexpr size_t kBatch = 4096;
+constexpr size_t kPasses = 4;
+constexpr size_t kWindow = 64;
+
+/**
+ * @brief Per-symbol analytics state; no heap members, so it can live in an arena
+ */
+struct alignas(64) SymbolState {
+    market::VWAPCalculator vwap;
+    market::TradeImbalanceCalculator imbalance;
+    market::EWMACalculator ewma;
+    market::RealizedVolatilityCalculator realized_vol;
+    double window[kWindow] = {};    // Rolling price window
+    double window_sum = 0.0;
+    uint32_t window_pos = 0;
+
+    void onTick(const market::CompactTick& tick) {
+        vwap.addSums(tick.price * tick.volume, tick.volume);
+        imbalance.addVolumes(tick.side == 'B' ? tick.volume : 0, tick.side == 'S' ? tick.volume : 0);
+        ewma.addPrice(tick.price);
+        realized_vol.addPrice(tick.price);
+        window_sum += tick.price - window[window_pos];
+        window[window_pos] = tick.price;
+        window_pos = (window_pos + 1) % kWindow;
+    }
+};
+
+/**
+ * @brief Open-addressed symbol -> index table over caller-provided storage
+ */
+struct SymbolTable {
+    uint64_t* keys;
+    uint32_t* values;
+    size_t mask;
+
+    static uint64_t pack(const char* symbol) {
+        uint64_t key = 0;
+        std::memcpy(&key, symbol, sizeof(key));
+        return key;
+    }
+
+    static size_t hash(uint64_t key) { return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32); }
+
+    void insert(uint64_t key, uint32_t value) {
+        size_t i = hash(key) & mask;
+        while (keys[i] != 0 && keys[i] != key) i = (i + 1) & mask;
+        keys[i] = key;
+        values[i] = value;
+    }
+
+    uint32_t find(uint64_t key) const {
+        size_t i = hash(key) & mask;
+        while (keys[i] != key) i = (i + 1) & mask;
+        return values[i];
+    }
+};
+
+struct PassStats {
+    double ns_per_tick = 0.0;
+    double p99_batch_ns = 0.0;     // P99 over batches of per-tick cost
+    double max_batch_ns = 0.0;
+};
+
+struct VariantResult {
+    std::string label;
+    std::string backing;
+    double setup_ms = 0.0;
+    std::vector<PassStats> passes;
+};
+
+using AllocateFn = std::function<void*(size_t bytes, size_t alignment)>;
+
+/**
+ * @brief Lay out ring, symbol table and state with the given allocator, then run passes
+ *
+ * Each batch writes kBatch ticks into the ring (producer side) and reads them
+ * back through the symbol table into per-symbol state (consumer side).
+ */
+VariantResult runVariant(const std::string& label, const std::string& backing, const AllocateFn& allocate,
+                         Clock::time_point setup_start) {
+    VariantResult result;
+    result.label = label;
+    result.backing = backing;
+
+    auto* ring = static_cast<market::CompactTick*>(allocate(sizeof(market::CompactTick) * kRingTicks, 64));
+    auto* states = static_cast<SymbolState*>(allocate(sizeof(SymbolState) * kSymbols, alignof(SymbolState)));
+    for (size_t s = 0; s < kSymbols; s++) new (states + s) SymbolState();
+
+    const size_t table_size = kSymbols * 2;
+    SymbolTable table;
+    table.keys = static_cast<uint64_t*>(allocate(sizeof(uint64_t) * table_size, 64));
+    table.values = static_cast<uint32_t*>(allocate(sizeof(uint32_t) * table_size, 64));
+    table.mask = table_size - 1;
+    std::memset(table.keys, 0, sizeof(uint64_t) * table_size);
+
+    std::vector<uint64_t> symbol_keys(kSymbols);
+    for (size_t s = 0; s < kSymbols; s++) {
+        char name[16] = {};
+        std::snprintf(name, sizeof(name), "S%05zu", s);
+        symbol_keys[s] = SymbolTable::pack(name);
+        table.insert(symbol_keys[s], static_cast<uint32_t>(s));
+    }
+    result.setup_ms = std::chrono::duration<double, std::milli>(Clock::now() - setup_start).count();
+
+    market::Xoshiro256PlusPlus rng(7);
+    double sink = 0.0;
+    for (size_t pass = 0; pass < kPasses; pass++) {
+        std::vector<double> batch_ns;
+        auto pass_start = Clock::now();
+        for (size_t base = 0; base < kRingTicks; base += kBatch) {
+            auto t0 = Clock::now();
+            for (size_t i = base; i < base + kBatch; i++) {
+                uint64_t bits = rng.next();
+                market::CompactTick& slot = ring[i];
+                std::memcpy(slot.symbol, &symbol_keys[bits % kSymbols], sizeof(slot.symbol));
+                slot.price = 100.0 + static_cast<double>((bits >> 32) & 1023) * 0.01;
+                slot.volume = 100 + static_cast<int32_t>((bits >> 42) & 511);
+                slot.side = (bits >> 63) ? 'B' : 'S';
+                slot.timestamp_ns = i;
+            }
+            for (size_t i = base; i < base + kBatch; i++) {
+                const market::CompactTick& tick = ring[i];
+                states[table.find(SymbolTable::pack(tick.symbol))].onTick(tick);
+            }
+            auto t1 = Clock::now();
+            batch_ns.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / kBatch);
+        }
+        double total_ns = std::chrono::duration<double, std::nano>(Clock::now() - pass_start).count();
+
+        PassStats stats;
+        stats.ns_per_tick = total_ns / kRingTicks;
+        std::sort(batch_ns.begin(), batch_ns.end());
+        stats.p99_batch_ns = batch_ns[std::min(batch_ns.size() - 1, batch_ns.size() * 99 / 100)];
+        stats.max_batch_ns = batch_ns.back();
+        result.passes.push_back(stats);
+    }
+    for (size_t s = 0; s < kSymbols; s++) sink += states[s].vwap.getVWAP();
+    if (sink < 0.0) std::cout << sink;    // Keep the work observable
+    return result;
+}
+
+void printVariant(const VariantResult& r) {
+    double steady_mean = 0.0, steady_p99 = 0.0;
+    for (size_t p = 1; p < r.passes.size(); p++) {
+        steady_mean += r.passes[p].ns_per_tick;
+        steady_p99 = std::max(steady_p99, r.passes[p].p99_batch_ns);
+    }
+    steady_mean /= static_cast<double>(r.passes.size() - 1);
+
+    std::cout << "  " << std::left << std::setw(26) << r.label << std::right << std::fixed
+              << std::setprecision(1) << std::setw(10) << r.setup_ms
+              << std::setprecision(2)
+              << std::setw(12) << r.passes[0].ns_per_tick << std::setw(11) << r.passes[0].p99_batch_ns
+              << std::setw(11) << r.passes[0].max_batch_ns
+              << std::setw(12) << steady_mean << std::setw(11) << steady_p99 << std::endl;
+    std::cout << "    " << r.backing << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Compare first-pass and steady-state cost of heap vs pre-faulted (huge-page) arena memory
+ */
+void runArenaBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Memory Arena - Huge Pages and Pre-faulting" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << kSymbols << " symbols (" << sizeof(SymbolState) << " B state each), "
+              << kRingTicks << "-tick ring (" << (kRingTicks * sizeof(market::CompactTick)) / (1024 * 1024)
+              << " MB), " << kPasses << " passes, batches of " << kBatch << std::endl;
+    std::cout << "Setup includes mapping, pre-faulting and building the symbol table; cost in ns/tick" << std::endl;
+
+    std::cout << "\n  " << std::left << std::setw(26) << "Memory" << std::right
+              << std::setw(10) << "Setup ms" << std::setw(12) << "First pass" << std::setw(11) << "P99 batch"
+              << std::setw(11) << "Max batch" << std::setw(12) << "Steady" << std::setw(11) << "P99 batch"
+              << std::endl;
+
+    const size_t bytes = kRingTicks * sizeof(market::CompactTick) + kSymbols * sizeof(SymbolState) +
+                         kSymbols * 2 * (sizeof(uint64_t) + sizeof(uint32_t)) + 4096;
+
+    {
+        // Heap: large blocks come back untouched, so the first pass takes the page faults
+        std::vector<std::unique_ptr<char[]>> blocks;
+        AllocateFn heap = [&blocks](size_t n, size_t alignment) -> void* {
+            blocks.emplace_back(new char[n + alignment]);
+            uintptr_t p = reinterpret_cast<uintptr_t>(blocks.back().get());
+            return reinterpret_cast<void*>((p + alignment - 1) & ~(uintptr_t(alignment) - 1));
+        };
+        printVariant(runVariant("heap (new[], lazy)", "operator new, faulted on first touch", heap, Clock::now()));
+    }
+
+    struct ArenaVariant { const char* label; bool huge; };
+    const ArenaVariant variants[] = {
+        {"arena 4KB, prefaulted", false},
+        {"arena 2MB, prefaulted", true},
+    };
+    for (const auto& v : variants) {
+        auto setup_start = Clock::now();
+        market::ArenaOptions options;
+        options.huge_pages = v.huge;
+        market::MemoryArena arena(bytes, options);
+        AllocateFn allocate = [&arena](size_t n, size_t alignment) { return arena.allocate(n, alignment); };
+        printVariant(runVariant(v.label, arena.describe(), allocate, setup_start));
+    }
+}
+
+} // namespace benchmark
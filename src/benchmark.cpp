@@ -1,172 +1,240 @@
 #include "benchmark.h"
+#include "benchmark_runner.h"
+#include "benchmark_report.h"
+#include "benchmark_compare.h"
 #include "market_tick.h"
-#include "tick_generator.h"
-#include "analytics.h"
 #include "lockfree_queue.h"
 #include "mutex_queue.h"
-#include <thread>
-#include <atomic>
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <memory>
 
 namespace benchmark {
 
+namespace {
+
 /**
- * @brief Producer thread function - generates and pushes ticks to queue
+ * @brief Warm up, then measure a configuration several times
  */
 template<typename QueueType>
-void producerThread(QueueType& queue, 
-                   size_t num_ticks,
-                   std::atomic<bool>& done,
-                   const std::string& symbol = "SPY") {
-    market::TickGenerator generator(symbol, 100.0, 0.01, 100, 1000);
-    
-    for (size_t i = 0; i < num_ticks; i++) {
-        auto tick = generator.generateTick();
-        queue.push(tick);
+BenchmarkSummary measureQueue(const std::string& queue, const std::string& name, size_t num_ticks,
+                              const RunOptions& options, size_t warmup, size_t repetitions) {
+    for (size_t w = 0; w < warmup; w++) {
+        runConfiguredBenchmark<QueueType>(name, num_ticks, options);
     }
-    
-    done.store(true, std::memory_order_release);
+    std::vector<BenchmarkResults> runs;
+    for (size_t r = 0; r < repetitions; r++) {
+        runs.push_back(runConfiguredBenchmark<QueueType>(name, num_ticks, options));
+    }
+    return BenchmarkSummary::fromRuns(queue, num_ticks, runs);
 }
 
 /**
- * @brief Consumer thread function - pops ticks, calculates analytics and latency
+ * @brief Configuration name shared by queues and run output, so either can baseline the other
  */
-template<typename QueueType>
-void consumerThread(QueueType& queue,
-                   std::atomic<bool>& producer_done,
-                   market::AnalyticsEngine& analytics,
-                   LatencyTracker& latency_tracker,
-                   ThroughputMeter& throughput) {
-    throughput.start();
-    
-    while (true) {
-        auto tick_opt = queue.pop();
-        
-        if (tick_opt.has_value()) {
-            auto& tick = tick_opt.value();
-            
-            // Calculate latency
-            uint64_t now = market::getCurrentTimeNanos();
-            double latency_us = market::calculateLatencyMicros(tick.timestamp_ns, now);
-            latency_tracker.addLatency(latency_us);
-            
-            // Process analytics
-            analytics.processTick(tick);
-            
-            // Update throughput
-            throughput.addItem();
-        } 
-        else {
-            // Queue is empty, check if producer is done
-            if (producer_done.load(std::memory_order_acquire)) {
-                // Double-check queue is truly empty before exiting
-                if (queue.empty()) {
-                    break;
-                }
-            }
-            // Brief yield to avoid busy-waiting
-            std::this_thread::yield();
-        }
-    }
-    
-    throughput.stop();
+std::string configName(const std::string& queue, size_t num_ticks) {
+    return queue + " (" + std::to_string(num_ticks) + ")";
 }
 
 /**
- * @brief Run benchmark with specified queue type
+ * @brief Run whose throughput is the median of the repetitions
  */
-template<typename QueueType>
-BenchmarkResults runBenchmark(const std::string& name, size_t num_ticks) {
-    std::cout << "\nRunning benchmark: " << name << " (" << num_ticks << " ticks)" << std::endl;
-    
-    // Create queue and synchronization primitives
-    QueueType queue;
-    std::atomic<bool> producer_done{false};
-    
-    // Create analytics and measurement tools
-    market::AnalyticsEngine analytics(100);
-    LatencyTracker latency_tracker;
-    ThroughputMeter throughput;
-    
-    // Launch threads
-    std::thread producer(producerThread<QueueType>, std::ref(queue), num_ticks, 
-                        std::ref(producer_done), "SPY");
-    std::thread consumer(consumerThread<QueueType>, std::ref(queue), 
-                        std::ref(producer_done), std::ref(analytics), 
-                        std::ref(latency_tracker), std::ref(throughput));
-    
-    // Wait for completion
-    producer.join();
-    consumer.join();
-    
-    // Collect results
-    BenchmarkResults results;
-    results.name = name;
-    results.ticks_processed = latency_tracker.getCount();
-    results.throughput_tps = throughput.getThroughput();
-    results.latency_mean = latency_tracker.getMean();
-    results.latency_p50 = latency_tracker.getP50();
-    results.latency_p99 = latency_tracker.getP99();
-    results.latency_p999 = latency_tracker.getP999();
-    results.latency_min = latency_tracker.getMin();
-    results.latency_max = latency_tracker.getMax();
-    results.elapsed_seconds = throughput.getElapsedSeconds();
-    
-    std::cout << "  Completed: " << results.ticks_processed << " ticks in " 
-              << results.elapsed_seconds << " seconds" << std::endl;
-    std::cout << "  Throughput: " << static_cast<int>(results.throughput_tps) << " ticks/sec" << std::endl;
-    std::cout << "  Latency P99: " << results.latency_p99 << " μs" << std::endl;
-    
-    return results;
+const BenchmarkResults& medianRun(const BenchmarkSummary& summary) {
+    std::vector<const BenchmarkResults*> order;
+    for (const auto& r : summary.runs) order.push_back(&r);
+    std::sort(order.begin(), order.end(), [](const BenchmarkResults* a, const BenchmarkResults* b) {
+        return a->throughput_tps < b->throughput_tps;
+    });
+    return *order[order.size() / 2];
+}
+
+void printSummaryLine(const BenchmarkSummary& s) {
+    std::cout << "  " << std::left << std::setw(28) << s.name << std::right << std::fixed
+              << std::setprecision(0) << std::setw(10) << s.throughput_tps.median << " ticks/sec"
+              << " [95% CI " << s.throughput_tps.ci95_low << "-" << s.throughput_tps.ci95_high << "]"
+              << " | P99 " << std::setprecision(2) << s.latency_p99.median << " μs"
+              << " [" << s.latency_p99.ci95_low << "-" << s.latency_p99.ci95_high << "]" << std::endl;
 }
 
+/**
+ * @brief Instantiate the runner for a queue chosen by name
+ */
+BenchmarkResults runNamedQueue(const std::string& queue, const std::string& name,
+                               size_t num_ticks, const RunOptions& options) {
+    if (queue == "mutex") {
+        return runConfiguredBenchmark<lockfree::MutexQueue<market::MarketTick>>(name, num_ticks, options);
+    }
+    return runConfiguredBenchmark<lockfree::SPSCQueue<market::MarketTick>>(name, num_ticks, options);
+}
+
+} // namespace
+
 /**
  * @brief Run comprehensive benchmarks comparing lock-free vs mutex queues
+ *
+ * Each configuration gets one discarded warmup run (thread start-up, page
+ * faults, allocator growth) and five measured runs; medians are compared.
  */
 void runComprehensiveBenchmarks() {
     std::cout << "\n========================================" << std::endl;
     std::cout << "Market Data Feed Handler - Benchmarks" << std::endl;
     std::cout << "========================================" << std::endl;
     
+    const size_t warmup = 1;
+    const size_t repetitions = 5;
+    RunOptions options;
+    options.perf_counters = true;
+    
+    std::vector<BenchmarkSummary> summaries;
     std::vector<BenchmarkResults> all_results;
     
     // Test with different tick counts
     std::vector<size_t> test_sizes = {10000, 50000, 100000, 500000, 1000000};
     
     for (size_t size : test_sizes) {
-        std::cout << "\n--- Testing with " << size << " ticks ---" << std::endl;
+        std::cout << "\n--- Testing with " << size << " ticks (" << warmup << " warmup, "
+                  << repetitions << " runs, median) ---" << std::endl;
         
         // Lock-free queue
-        auto lockfree_results = runBenchmark<lockfree::SPSCQueue<market::MarketTick>>(
-            "Lock-Free SPSC (" + std::to_string(size) + ")", size);
-        all_results.push_back(lockfree_results);
+        auto lockfree_summary = measureQueue<lockfree::SPSCQueue<market::MarketTick>>(
+            "lockfree", configName("lockfree", size), size, options, warmup, repetitions);
+        printSummaryLine(lockfree_summary);
         
         // Mutex queue
-        auto mutex_results = runBenchmark<lockfree::MutexQueue<market::MarketTick>>(
-            "Mutex Queue (" + std::to_string(size) + ")", size);
-        all_results.push_back(mutex_results);
+        auto mutex_summary = measureQueue<lockfree::MutexQueue<market::MarketTick>>(
+            "mutex", configName("mutex", size), size, options, warmup, repetitions);
+        printSummaryLine(mutex_summary);
         
         // Show comparison
         std::cout << "\n  Speedup: " << std::fixed << std::setprecision(2)
-                  << (lockfree_results.throughput_tps / mutex_results.throughput_tps) << "x faster" << std::endl;
+                  << (lockfree_summary.throughput_tps.median / mutex_summary.throughput_tps.median) << "x faster" << std::endl;
         std::cout << "  Latency improvement: " 
-                  << (mutex_results.latency_p99 / lockfree_results.latency_p99) << "x better P99" << std::endl;
+                  << (mutex_summary.latency_p99.median / lockfree_summary.latency_p99.median) << "x better P99" << std::endl;
+        
+        for (const auto* s : {&lockfree_summary, &mutex_summary}) {
+            all_results.insert(all_results.end(), s->runs.begin(), s->runs.end());
+            summaries.push_back(*s);
+        }
     }
     
-    // Print summary
+    // Print summary (median run of each configuration)
     std::cout << "\n========================================" << std::endl;
-    std::cout << "Summary of All Benchmarks" << std::endl;
+    std::cout << "Summary of All Benchmarks (median runs)" << std::endl;
     std::cout << "========================================" << std::endl;
     
-    for (const auto& r : all_results) {
-        r.print();
+    for (const auto& s : summaries) {
+        medianRun(s).print();
     }
     
-    // Export to CSV
+    // Export per-run CSV and aggregated JSON
     BenchmarkResults::exportToCSV(all_results, "benchmark_results.csv");
-    std::cout << "\nResults exported to: benchmark_results.csv" << std::endl;
+    BenchmarkConfig config;
+    config.warmup = warmup;
+    config.repetitions = repetitions;
+    config.run = options;
+    exportToJSON(summaries, config, "benchmark_results.json");
+    std::cout << "\nResults exported to: benchmark_results.csv, benchmark_results.json" << std::endl;
+}
+
+/**
+ * @brief Run the benchmark matrix described by a command-line config
+ */
+int runConfiguredBenchmarks(const BenchmarkConfig& config) {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Market Data Feed Handler - Configured Benchmarks" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Producers " << config.run.producers << ", consumers " << config.run.consumers
+              << ", wait " << waitStrategyName(config.run.wait)
+              << ", rate " << (config.run.rate_tps > 0.0 ? std::to_string(static_cast<long>(config.run.rate_tps)) : "closed-loop")
+              << ", warmup " << config.warmup << ", reps " << config.repetitions << std::endl;
+
+    // Live telemetry spans the whole matrix so counters stay monotonic
+    RunOptions run = config.run;
+    market::TelemetryRegistry registry;
+    std::unique_ptr<market::TelemetryExporter> exporter;
+    if (!config.telemetry.file_path.empty() || !config.telemetry.socket_path.empty()) {
+        exporter.reset(new market::TelemetryExporter(registry, config.telemetry));
+        if (exporter->start()) {
+            run.telemetry = &registry;
+            std::cout << "Telemetry every " << config.telemetry.interval.count() << " ms to "
+                      << (config.telemetry.file_path.empty() ? "" : config.telemetry.file_path + " ")
+                      << (config.telemetry.socket_path.empty() ? "" : "unix:" + config.telemetry.socket_path)
+                      << std::endl;
+        } else {
+            std::cerr << "Warning: telemetry disabled: " << exporter->getError() << std::endl;
+        }
+    }
+
+    std::vector<BenchmarkSummary> summaries;
+    std::vector<BenchmarkResults> all_runs;
+
+    for (size_t ticks : config.tick_counts) {
+        for (const auto& queue : config.queues) {
+            std::string name = configName(queue, ticks);
+
+            for (size_t w = 0; w < config.warmup; w++) {
+                runNamedQueue(queue, name, ticks, run);
+            }
+
+            std::vector<BenchmarkResults> runs;
+            for (size_t r = 0; r < config.repetitions; r++) {
+                runs.push_back(runNamedQueue(queue, name, ticks, run));
+            }
+            all_runs.insert(all_runs.end(), runs.begin(), runs.end());
+
+            BenchmarkSummary summary = BenchmarkSummary::fromRuns(queue, ticks, runs);
+            printSummaryLine(summary);
+            if (config.run.perf_counters) {
+                PerfSample producer_perf, consumer_perf;
+                size_t total_ticks = 0;
+                for (const auto& r : runs) {
+                    producer_perf.add(r.producer_perf);
+                    consumer_perf.add(r.consumer_perf);
+                    total_ticks += r.ticks_processed;
+                }
+                printPerfSummary("  Producer", producer_perf, total_ticks);
+                printPerfSummary("  Consumer", consumer_perf, total_ticks);
+            }
+            QueueDepthHistogram depth;
+            for (const auto& r : runs) depth.merge(r.queue_depth);
+            std::cout << "    Queue depth: mean " << std::setprecision(0) << depth.getMean()
+                      << ", P99 " << depth.getPercentile(0.99) << ", max " << depth.getMax()
+                      << " (" << depth.getSamples() << " samples)" << std::endl;
+            if (config.run.trace_every > 0) {
+                StageBreakdown stages;
+                for (const auto& r : runs) stages.merge(r.stages);
+                printStageBreakdown("  Stages", stages);
+            }
+            summaries.push_back(summary);
+        }
+    }
+
+    if (run.telemetry) exporter->stop();   // Final publication with the completed totals
+
+    if (!config.json_path.empty()) {
+        if (exportToJSON(summaries, config, config.json_path)) {
+            std::cout << "\nResults exported to: " << config.json_path << std::endl;
+        } else {
+            std::cerr << "\nFailed to write " << config.json_path << std::endl;
+        }
+    }
+    if (!config.csv_path.empty()) {
+        BenchmarkResults::exportToCSV(all_runs, config.csv_path);
+        std::cout << "Per-run results exported to: " << config.csv_path << std::endl;
+    }
+
+    if (config.baseline_path.empty()) return 0;
+    BaselineSet baseline;
+    std::string error;
+    if (!loadBaseline(config.baseline_path, baseline, error)) {
+        std::cerr << "\nCannot load baseline: " << error << std::endl;
+        return 1;
+    }
+    CompareOptions compare;
+    compare.alpha = config.significance;
+    compare.threshold = config.regression_threshold;
+    return compareResults(baseline, samplesFromSummaries(summaries), compare).exitCode();
 }
 
 } // namespace benchmark
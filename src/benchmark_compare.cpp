@@ -0,0 +1,403 @@
+#include "benchmark.h"
+#include "benchmark_compare.h"
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+namespace benchmark {
+
+namespace {
+
+/**
+ * @brief Just enough JSON to read back files written by exportToJSON()
+ */
+struct JsonValue {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+    Type type = Type::Null;
+    bool boolean = false;
+    double number = 0.0;
+    std::string string;
+    std::vector<JsonValue> array;
+    std::vector<std::pair<std::string, JsonValue>> object;
+
+    const JsonValue* get(const std::string& key) const {
+        for (const auto& kv : object) {
+            if (kv.first == key) return &kv.second;
+        }
+        return nullptr;
+    }
+};
+
+class JsonParser {
+private:
+    const std::string& text_;
+    size_t pos_;
+
+    void skipSpace() {
+        while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) pos_++;
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (pos_ < text_.size() && text_[pos_] == c) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    bool parseString(std::string& out) {
+        if (!consume('"')) return false;
+        out.clear();
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            char c = text_[pos_++];
+            if (c == '\\' && pos_ < text_.size()) {
+                char e = text_[pos_++];
+                switch (e) {
+                    case 'n': out += '\n'; break;
+                    case 't': out += '\t'; break;
+                    case 'u': pos_ += 4; out += '?'; break;   // Not produced for our keys
+                    default: out += e;
+                }
+            } else {
+                out += c;
+            }
+        }
+        return consume('"');
+    }
+
+public:
+    explicit JsonParser(const std::string& text) : text_(text), pos_(0) {}
+
+    bool parse(JsonValue& out) {
+        skipSpace();
+        if (pos_ >= text_.size()) return false;
+        char c = text_[pos_];
+
+        if (c == '{') {
+            pos_++;
+            out.type = JsonValue::Type::Object;
+            if (consume('}')) return true;
+            do {
+                std::string key;
+                JsonValue value;
+                if (!parseString(key) || !consume(':') || !parse(value)) return false;
+                out.object.emplace_back(std::move(key), std::move(value));
+            } while (consume(','));
+            return consume('}');
+        }
+        if (c == '[') {
+            pos_++;
+            out.type = JsonValue::Type::Array;
+            if (consume(']')) return true;
+            do {
+                JsonValue value;
+                if (!parse(value)) return false;
+                out.array.push_back(std::move(value));
+            } while (consume(','));
+            return consume(']');
+        }
+        if (c == '"') {
+            out.type = JsonValue::Type::String;
+            return parseString(out.string);
+        }
+        if (text_.compare(pos_, 4, "true") == 0) {
+            pos_ += 4;
+            out.type = JsonValue::Type::Bool;
+            out.boolean = true;
+            return true;
+        }
+        if (text_.compare(pos_, 5, "false") == 0) {
+            pos_ += 5;
+            out.type = JsonValue::Type::Bool;
+            return true;
+        }
+        if (text_.compare(pos_, 4, "null") == 0) {
+            pos_ += 4;
+            return true;
+        }
+
+        char* end = nullptr;
+        out.number = std::strtod(text_.c_str() + pos_, &end);
+        if (end == text_.c_str() + pos_) return false;
+        pos_ = static_cast<size_t>(end - text_.c_str());
+        out.type = JsonValue::Type::Number;
+        return true;
+    }
+};
+
+bool loadJsonBaseline(const std::string& text, BaselineSet& out, std::string& error) {
+    JsonValue root;
+    JsonParser parser(text);
+    if (!parser.parse(root) || root.type != JsonValue::Type::Object) {
+        error = "malformed JSON";
+        return false;
+    }
+    const JsonValue* results = root.get("results");
+    if (!results || results->type != JsonValue::Type::Array) {
+        error = "JSON has no \"results\" array";
+        return false;
+    }
+
+    for (const auto& entry : results->array) {
+        std::string name;
+        if (const JsonValue* n = entry.get("name")) {
+            name = n->string;
+        } else {
+            const JsonValue* queue = entry.get("queue");
+            const JsonValue* ticks = entry.get("ticks");
+            if (!queue || !ticks) continue;
+            name = queue->string + " (" + std::to_string(static_cast<size_t>(ticks->number)) + ")";
+        }
+
+        const JsonValue* runs = entry.get("runs");
+        if (!runs) continue;
+        BaselineSamples& samples = out[name];
+        for (const auto& run : runs->array) {
+            const JsonValue* tps = run.get("throughput_tps");
+            const JsonValue* p99 = run.get("latency_p99_us");
+            if (tps && tps->type == JsonValue::Type::Number) samples.throughput_tps.push_back(tps->number);
+            if (p99 && p99->type == JsonValue::Type::Number) samples.latency_p99.push_back(p99->number);
+        }
+    }
+    return true;
+}
+
+bool loadCsvBaseline(std::istream& in, BaselineSet& out, std::string& error) {
+    std::string line;
+    if (!std::getline(in, line)) {
+        error = "empty CSV";
+        return false;
+    }
+
+    std::vector<std::string> header;
+    std::stringstream hs(line);
+    std::string cell;
+    while (std::getline(hs, cell, ',')) header.push_back(cell);
+
+    int name_col = -1, tps_col = -1, p99_col = -1;
+    for (size_t i = 0; i < header.size(); i++) {
+        if (header[i] == "Name") name_col = static_cast<int>(i);
+        if (header[i] == "Throughput_TPS") tps_col = static_cast<int>(i);
+        if (header[i] == "Latency_P99") p99_col = static_cast<int>(i);
+    }
+    if (name_col < 0 || tps_col < 0 || p99_col < 0) {
+        error = "CSV lacks Name/Throughput_TPS/Latency_P99 columns";
+        return false;
+    }
+
+    while (std::getline(in, line)) {
+        if (line.empty()) continue;
+        std::vector<std::string> cells;
+        std::stringstream ls(line);
+        while (std::getline(ls, cell, ',')) cells.push_back(cell);
+        if (static_cast<int>(cells.size()) <= std::max(name_col, std::max(tps_col, p99_col))) continue;
+        BaselineSamples& samples = out[cells[name_col]];
+        samples.throughput_tps.push_back(std::atof(cells[tps_col].c_str()));
+        samples.latency_p99.push_back(std::atof(cells[p99_col].c_str()));
+    }
+    return true;
+}
+
+/**
+ * @brief Continued fraction for the incomplete beta function (modified Lentz)
+ */
+double betaContinuedFraction(double a, double b, double x) {
+    const double tiny = 1e-300;
+    double qab = a + b, qap = a + 1.0, qam = a - 1.0;
+    double c = 1.0;
+    double d = 1.0 - qab * x / qap;
+    if (std::fabs(d) < tiny) d = tiny;
+    d = 1.0 / d;
+    double h = d;
+    for (int m = 1; m <= 200; m++) {
+        int m2 = 2 * m;
+        double aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+        d = 1.0 + aa * d;
+        if (std::fabs(d) < tiny) d = tiny;
+        c = 1.0 + aa / c;
+        if (std::fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        h *= d * c;
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+        d = 1.0 + aa * d;
+        if (std::fabs(d) < tiny) d = tiny;
+        c = 1.0 + aa / c;
+        if (std::fabs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        double del = d * c;
+        h *= del;
+        if (std::fabs(del - 1.0) < 1e-12) break;
+    }
+    return h;
+}
+
+/**
+ * @brief Regularized incomplete beta function I_x(a, b)
+ */
+double incompleteBeta(double a, double b, double x) {
+    if (x <= 0.0) return 0.0;
+    if (x >= 1.0) return 1.0;
+    double front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) +
+                            a * std::log(x) + b * std::log(1.0 - x));
+    if (x < (a + 1.0) / (a + b + 2.0)) return front * betaContinuedFraction(a, b, x) / a;
+    return 1.0 - front * betaContinuedFraction(b, a, 1.0 - x) / b;
+}
+
+/**
+ * @brief Print one comparison row; return true if it is a regression
+ */
+bool compareMetric(const std::string& name, const char* metric, bool higher_is_better,
+                   const std::vector<double>& base, const std::vector<double>& cur,
+                   const CompareOptions& options) {
+    if (base.empty() || cur.empty()) return false;
+    SampleStats b = SampleStats::of(base);
+    SampleStats c = SampleStats::of(cur);
+    double change = b.mean != 0.0 ? (c.mean - b.mean) / b.mean : 0.0;
+    bool testable = base.size() > 1 && cur.size() > 1;
+    double p = welchTTestPValue(base, cur);
+    bool significant = !testable || p < options.alpha;
+    bool worse = higher_is_better ? change < -options.threshold : change > options.threshold;
+    bool better = higher_is_better ? change > options.threshold : change < -options.threshold;
+
+    const char* verdict = "ok";
+    if (worse && significant) verdict = "REGRESSION";
+    else if (better && significant) verdict = "improved";
+
+    std::cout << "  " << std::left << std::setw(24) << name << std::setw(12) << metric << std::right
+              << std::fixed << std::setprecision(2)
+              << std::setw(14) << b.median << std::setw(14) << c.median
+              << std::setw(9) << std::showpos << change * 100.0 << "%" << std::noshowpos;
+    if (testable) {
+        std::cout << std::setw(9) << std::setprecision(4) << p;
+    } else {
+        std::cout << std::setw(9) << "n/a";
+    }
+    std::cout << "  " << verdict << std::endl;
+    return worse && significant;
+}
+
+} // namespace
+
+bool loadBaseline(const std::string& path, BaselineSet& out, std::string& error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        error = "cannot open " + path;
+        return false;
+    }
+
+    // JSON if the first non-space character opens an object
+    char first = 0;
+    while (file.get(first) && std::isspace(static_cast<unsigned char>(first))) {}
+    file.seekg(0);
+    if (first == '{') {
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return loadJsonBaseline(buffer.str(), out, error);
+    }
+    return loadCsvBaseline(file, out, error);
+}
+
+BaselineSet samplesFromSummaries(const std::vector<BenchmarkSummary>& summaries) {
+    BaselineSet set;
+    for (const auto& s : summaries) {
+        BaselineSamples& samples = set[s.name];
+        for (const auto& r : s.runs) {
+            samples.throughput_tps.push_back(r.throughput_tps);
+            samples.latency_p99.push_back(r.latency_p99);
+        }
+    }
+    return set;
+}
+
+double welchTTestPValue(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.size() < 2 || b.size() < 2) return 1.0;
+    SampleStats sa = SampleStats::of(a);
+    SampleStats sb = SampleStats::of(b);
+    double va = sa.stddev * sa.stddev / a.size();
+    double vb = sb.stddev * sb.stddev / b.size();
+    double se2 = va + vb;
+    if (se2 <= 0.0) return sa.mean == sb.mean ? 1.0 : 0.0;
+
+    double t = (sa.mean - sb.mean) / std::sqrt(se2);
+    double df = se2 * se2 / (va * va / (a.size() - 1) + vb * vb / (b.size() - 1));
+    return incompleteBeta(0.5 * df, 0.5, df / (df + t * t));
+}
+
+CompareOutcome compareResults(const BaselineSet& baseline, const BaselineSet& current,
+                              const CompareOptions& options) {
+    std::ios_base::fmtflags flags = std::cout.flags();
+    std::streamsize precision = std::cout.precision();
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Baseline Comparison (Welch t-test, alpha " << options.alpha
+              << ", threshold " << options.threshold * 100.0 << "%)" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "  " << std::left << std::setw(24) << "Config" << std::setw(12) << "Metric" << std::right
+              << std::setw(14) << "Base median" << std::setw(14) << "Cur median"
+              << std::setw(10) << "Change" << std::setw(9) << "p" << "  Verdict" << std::endl;
+
+    CompareOutcome outcome;
+    for (const auto& kv : current) {
+        auto it = baseline.find(kv.first);
+        if (it == baseline.end()) continue;
+        outcome.matched++;
+        if (compareMetric(kv.first, "throughput", true, it->second.throughput_tps,
+                          kv.second.throughput_tps, options)) outcome.regressions++;
+        if (compareMetric(kv.first, "p99_us", false, it->second.latency_p99,
+                          kv.second.latency_p99, options)) outcome.regressions++;
+    }
+
+    if (outcome.matched == 0) {
+        std::cout << "  ERROR: no configurations in common with the baseline" << std::endl;
+    }
+    std::cout << "\n" << outcome.regressions << " regression(s) across " << outcome.matched
+              << " configuration(s)" << std::endl;
+    std::cout.flags(flags);
+    std::cout.precision(precision);
+    return outcome;
+}
+
+/**
+ * @brief Compare two saved result files (JSON or CSV)
+ */
+int runCompare(int argc, char* argv[]) {
+    std::vector<std::string> files;
+    CompareOptions options;
+    std::string error;
+    for (int i = 0; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--threshold" || arg == "--alpha") {
+            if (i + 1 >= argc) {
+                error = "missing value for " + arg;
+            } else if (arg == "--threshold") {
+                parseThresholdOption(argv[++i], options.threshold, error);
+            } else {
+                parseAlphaOption(argv[++i], options.alpha, error);
+            }
+            if (!error.empty()) {
+                std::cerr << "Error: " << error << std::endl;
+                return 1;
+            }
+        } else {
+            files.push_back(arg);
+        }
+    }
+    if (files.size() != 2) {
+        std::cerr << "Usage: compare BASELINE CURRENT [--threshold PCT] [--alpha A]" << std::endl;
+        return 1;
+    }
+
+    BaselineSet baseline, current;
+    if (!loadBaseline(files[0], baseline, error) || !loadBaseline(files[1], current, error)) {
+        std::cerr << "Error: " << error << std::endl;
+        return 1;
+    }
+    return compareResults(baseline, current, options).exitCode();
+}
+
+} // namespace benchmark
@@ -0,0 +1,262 @@
+#include "benchmark_config.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+
+namespace benchmark {
+
+namespace {
+
+bool parseSize(const std::string& text, size_t& out) {
+    if (text.empty() || text[0] == '-') return false;
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(text.c_str(), &end, 10);
+    // Accept K/M suffixes for tick counts and rates
+    if (*end == 'K' || *end == 'k') { value *= 1000ULL; end++; }
+    else if (*end == 'M' || *end == 'm') { value *= 1000000ULL; end++; }
+    if (*end != '\0') return false;
+    out = static_cast<size_t>(value);
+    return true;
+}
+
+bool parseInt(const std::string& text, int& out) {
+    if (text.empty()) return false;
+    char* end = nullptr;
+    long value = std::strtol(text.c_str(), &end, 10);
+    if (*end != '\0') return false;
+    out = static_cast<int>(value);
+    return true;
+}
+
+bool parseDouble(const std::string& text, double& out) {
+    if (text.empty()) return false;
+    char* end = nullptr;
+    double value = std::strtod(text.c_str(), &end);
+    if (*end != '\0' || !std::isfinite(value)) return false;
+    out = value;
+    return true;
+}
+
+std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+} // namespace
+
+bool parseWaitStrategy(const std::string& name, WaitStrategy& out) {
+    if (name == "spin") { out = WaitStrategy::Spin; return true; }
+    if (name == "yield") { out = WaitStrategy::Yield; return true; }
+    if (name == "sleep") { out = WaitStrategy::Sleep; return true; }
+    return false;
+}
+
+const char* waitStrategyName(WaitStrategy strategy) {
+    switch (strategy) {
+        case WaitStrategy::Spin: return "spin";
+        case WaitStrategy::Yield: return "yield";
+        case WaitStrategy::Sleep: return "sleep";
+    }
+    return "unknown";
+}
+
+const std::vector<std::string>& availableQueues() {
+    static const std::vector<std::string> queues = {"lockfree", "mutex"};
+    return queues;
+}
+
+bool parseThresholdOption(const std::string& value, double& fraction, std::string& error) {
+    double pct = 0.0;
+    if (!parseDouble(value, pct) || pct < 0.0) {
+        error = "invalid --threshold '" + value + "' (percent)";
+        return false;
+    }
+    fraction = pct / 100.0;
+    return true;
+}
+
+bool parseAlphaOption(const std::string& value, double& alpha, std::string& error) {
+    double parsed = 0.0;
+    if (!parseDouble(value, parsed) || parsed <= 0.0 || parsed >= 1.0) {
+        error = "invalid --alpha '" + value + "'";
+        return false;
+    }
+    alpha = parsed;
+    return true;
+}
+
+bool parseBenchmarkArgs(int argc, char* argv[], BenchmarkConfig& config, std::string& error) {
+    for (int i = 0; i < argc; i++) {
+        std::string arg = argv[i];
+
+        if (arg == "-h" || arg == "--help") {
+            error.clear();
+            return false;
+        }
+
+        if (arg == "--perf") {
+            config.run.perf_counters = true;
+            continue;
+        }
+
+        if (i + 1 >= argc) {
+            error = "missing value for " + arg;
+            return false;
+        }
+        std::string value = argv[++i];
+
+        if (arg == "--queue") {
+            config.queues = value == "all" ? availableQueues() : splitList(value);
+            for (const auto& q : config.queues) {
+                const auto& known = availableQueues();
+                if (std::find(known.begin(), known.end(), q) == known.end()) {
+                    error = "unknown queue '" + q + "'";
+                    return false;
+                }
+            }
+        } else if (arg == "--ticks") {
+            config.tick_counts.clear();
+            for (const auto& item : splitList(value)) {
+                size_t n;
+                if (!parseSize(item, n) || n == 0) {
+                    error = "invalid tick count '" + item + "'";
+                    return false;
+                }
+                config.tick_counts.push_back(n);
+            }
+        } else if (arg == "--producers") {
+            if (!parseSize(value, config.run.producers) || config.run.producers == 0) {
+                error = "invalid producer count '" + value + "'";
+                return false;
+            }
+        } else if (arg == "--consumers") {
+            if (!parseSize(value, config.run.consumers) || config.run.consumers == 0) {
+                error = "invalid consumer count '" + value + "'";
+                return false;
+            }
+        } else if (arg == "--wait") {
+            if (!parseWaitStrategy(value, config.run.wait)) {
+                error = "invalid wait strategy '" + value + "'";
+                return false;
+            }
+        } else if (arg == "--pin") {
+            // --pin P,C : first producer on CPU P, first consumer on CPU C
+            std::vector<std::string> cpus = splitList(value);
+            if (cpus.size() != 2 || !parseInt(cpus[0], config.run.producer_cpu) ||
+                !parseInt(cpus[1], config.run.consumer_cpu)) {
+                error = "invalid --pin '" + value + "' (expected PRODUCER_CPU,CONSUMER_CPU)";
+                return false;
+            }
+        } else if (arg == "--rt-priority") {
+            if (!parseInt(value, config.run.rt_priority) || config.run.rt_priority < 0 ||
+                config.run.rt_priority > 99) {
+                error = "invalid --rt-priority '" + value + "' (expected 0-99)";
+                return false;
+            }
+        } else if (arg == "--mem-node") {
+            if (!parseInt(value, config.run.memory_node)) {
+                error = "invalid --mem-node '" + value + "'";
+                return false;
+            }
+        } else if (arg == "--rate") {
+            size_t rate;
+            if (!parseSize(value, rate)) {
+                error = "invalid rate '" + value + "'";
+                return false;
+            }
+            config.run.rate_tps = static_cast<double>(rate);
+        } else if (arg == "--trace") {
+            size_t every;
+            if (!parseSize(value, every) || every == 0) {
+                error = "invalid --trace '" + value + "' (expected N > 0)";
+                return false;
+            }
+            config.run.trace_every = every;
+        } else if (arg == "--telemetry-file") {
+            config.telemetry.file_path = value;
+        } else if (arg == "--telemetry-socket") {
+            config.telemetry.socket_path = value;
+        } else if (arg == "--telemetry-interval") {
+            size_t ms;
+            if (!parseSize(value, ms) || ms == 0) {
+                error = "invalid --telemetry-interval '" + value + "' (milliseconds)";
+                return false;
+            }
+            config.telemetry.interval = std::chrono::milliseconds(ms);
+        } else if (arg == "--warmup") {
+            if (!parseSize(value, config.warmup)) {
+                error = "invalid warmup count '" + value + "'";
+                return false;
+            }
+        } else if (arg == "--reps" || arg == "--repetitions") {
+            if (!parseSize(value, config.repetitions) || config.repetitions == 0) {
+                error = "invalid repetition count '" + value + "'";
+                return false;
+            }
+        } else if (arg == "--symbol") {
+            config.run.symbol = value;
+        } else if (arg == "--json") {
+            config.json_path = value;
+        } else if (arg == "--csv") {
+            config.csv_path = value;
+        } else if (arg == "--baseline") {
+            config.baseline_path = value;
+        } else if (arg == "--threshold") {
+            if (!parseThresholdOption(value, config.regression_threshold, error)) return false;
+        } else if (arg == "--alpha") {
+            if (!parseAlphaOption(value, config.significance, error)) return false;
+        } else {
+            error = "unknown option '" + arg + "'";
+            return false;
+        }
+    }
+
+    // The linked-list SPSC queue is only safe with one thread on each end
+    bool lockfree = std::find(config.queues.begin(), config.queues.end(), "lockfree") != config.queues.end();
+    if (lockfree && (config.run.producers > 1 || config.run.consumers > 1)) {
+        error = "queue 'lockfree' is single-producer/single-consumer; use --queue mutex for "
+                "multiple producers or consumers";
+        return false;
+    }
+
+    return true;
+}
+
+void printBenchmarkUsage(const char* program) {
+    std::cout << "Usage: " << program << " run [options]\n"
+              << "\n"
+              << "Options:\n"
+              << "  --queue LIST        Queues to test: lockfree,mutex or all (default lockfree,mutex)\n"
+              << "  --ticks LIST        Tick counts per run, K/M suffixes allowed (default 100K,1M)\n"
+              << "  --producers N       Producer threads (default 1)\n"
+              << "  --consumers N       Consumer threads (default 1)\n"
+              << "  --wait STRATEGY     Consumer idle strategy: spin, yield, sleep (default yield)\n"
+              << "  --pin P,C           Pin first producer to CPU P, first consumer to CPU C\n"
+              << "  --rt-priority N     Run pipeline threads SCHED_FIFO at priority N (needs CAP_SYS_NICE)\n"
+              << "  --mem-node N        Prefer NUMA node N for queue storage allocated by producers\n"
+              << "  --perf              Report per-tick hardware counters (cycles, IPC, misses)\n"
+              << "  --rate TPS          Open-loop offered rate, total across producers (default 0 = flat out)\n"
+              << "  --trace N           Trace 1 in N ticks through generate/enqueue/dwell/dequeue/analytics\n"
+              << "  --telemetry-file P  Rewrite Prometheus text metrics to P while running\n"
+              << "  --telemetry-socket P  Serve Prometheus text metrics on Unix socket P while running\n"
+              << "  --telemetry-interval MS  Telemetry aggregation interval (default 1000)\n"
+              << "  --warmup N          Discarded runs per configuration (default 1)\n"
+              << "  --reps N            Measured runs per configuration (default 5)\n"
+              << "  --symbol SYM        Ticker symbol for generated ticks (default SPY)\n"
+              << "  --json PATH         JSON output file (default benchmark_results.json)\n"
+              << "  --csv PATH          Also write per-run CSV\n"
+              << "  --baseline PATH     Compare against earlier JSON/CSV results; exit 2 on regression\n"
+              << "  --threshold PCT     Smallest change counted as a regression (default 5)\n"
+              << "  --alpha A           Significance level for the Welch t-test (default 0.05)\n"
+              << "\n"
+              << "       " << program << " compare BASELINE CURRENT [--threshold PCT] [--alpha A]\n";
+}
+
+} // namespace benchmark
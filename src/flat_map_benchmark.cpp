@@ -0,0 +1,207 @@
+#include "benchmark.h"
+#include "flat_hash_map.h"
+#include "symbol_registry.h"
+#include "fast_rng.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief Per-symbol running state updated on every tick
+ */
+struct SymbolState {
+    double price_volume = 0.0;
+    int64_t volume = 0;
+    double last_price = 0.0;
+    uint64_t ticks = 0;
+};
+
+/**
+ * @brief Resting order tracked by id
+ */
+struct Order {
+    double price = 0.0;
+    int32_t quantity = 0;
+    char side = 'B';
+    uint32_t symbol = 0;
+};
+
+double nanosSince(Clock::time_point start, size_t ops) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / ops;
+}
+
+/**
+ * @brief Symbol -> state: one lookup and update per tick over a fixed universe
+ */
+template<typename Map>
+double runSymbolState(Map& map, const std::vector<uint64_t>& stream, double& check) {
+    auto start = Clock::now();
+    for (size_t i = 0; i < stream.size(); i++) {
+        SymbolState& s = map[stream[i]];
+        double price = 100.0 + static_cast<double>(i & 1023) * 0.01;
+        s.price_volume += price * 100;
+        s.volume += 100;
+        s.last_price = price;
+        s.ticks++;
+    }
+    double ns = nanosSince(start, stream.size());
+    check = static_cast<double>(map[stream[0]].volume);
+    return ns;
+}
+
+struct OrderTimings {
+    double step_ns = 0.0;      // One add + execute + cancel
+    double hit_ns = 0.0;       // Lookup of a live order
+    double miss_ns = 0.0;      // Lookup of an id never seen
+};
+
+/**
+ * @brief Order id -> order: add, execute (lookup) and cancel around a steady live set
+ *
+ * Ids increase with random gaps like exchange order ids; executions and
+ * cancels hit uniformly random live orders. Both maps see the same ops.
+ */
+template<typename Insert, typename Find, typename Erase>
+OrderTimings runOrderBook(size_t live_target, size_t steps, Insert insert, Find find, Erase erase) {
+    market::Xoshiro256PlusPlus rng(5);
+    std::vector<uint64_t> live;
+    live.reserve(live_target + 1);
+    uint64_t next_id = 1000000;
+
+    // Fill to the steady-state size
+    for (size_t i = 0; i < live_target; i++) {
+        next_id += 1 + (rng.next() & 7);
+        insert(next_id, Order{100.0, 100, 'B', static_cast<uint32_t>(i & 4095)});
+        live.push_back(next_id);
+    }
+
+    // Pre-draw operations so RNG cost stays outside the timed loops
+    std::vector<uint64_t> draws(steps * 3);
+    for (auto& d : draws) d = rng.next();
+
+    OrderTimings t;
+    double sink = 0.0;
+    auto start = Clock::now();
+    for (size_t i = 0; i < steps; i++) {
+        next_id += 1 + (draws[3 * i] & 7);
+        insert(next_id, Order{100.0 + (draws[3 * i] & 255) * 0.01, 100, 'S', static_cast<uint32_t>(i & 4095)});
+        live.push_back(next_id);
+
+        const Order* o = find(live[draws[3 * i + 1] % live.size()]);
+        sink += o ? o->price : 0.0;
+
+        size_t victim = draws[3 * i + 2] % live.size();
+        erase(live[victim]);
+        live[victim] = live.back();
+        live.pop_back();
+    }
+    t.step_ns = nanosSince(start, steps);
+
+    start = Clock::now();
+    for (size_t i = 0; i < steps; i++) {
+        const Order* o = find(live[draws[3 * i + 1] % live.size()]);
+        sink += o ? o->price : 0.0;
+    }
+    t.hit_ns = nanosSince(start, steps);
+
+    // Ids below the first one ever issued are never present
+    start = Clock::now();
+    for (size_t i = 0; i < steps; i++) {
+        const Order* o = find(draws[3 * i + 1] % 1000000);
+        sink += o ? o->price : 0.0;
+    }
+    t.miss_ns = nanosSince(start, steps);
+
+    if (sink < 0.0) std::cout << sink;    // Keep the work observable
+    return t;
+}
+
+void printOrderRow(const std::string& label, const OrderTimings& t) {
+    std::cout << "  " << std::left << std::setw(30) << label << std::right << std::fixed << std::setprecision(1)
+              << std::setw(10) << t.step_ns << std::setw(10) << t.hit_ns << std::setw(10) << t.miss_ns
+              << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief FlatHashMap vs std::unordered_map for symbol state and order-id lookups
+ */
+void runFlatMapBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Flat Hash Map vs std::unordered_map" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    // Symbol -> state, keyed by packed symbol
+    const size_t stream_len = 4000000;
+    const size_t universes[] = {500, 5000, 50000};
+    std::cout << "\nSymbol -> state (" << stream_len << " ticks, uniformly random symbol, packed uint64 key)"
+              << std::endl;
+    std::cout << "  " << std::right << std::setw(10) << "Symbols" << std::setw(20) << "unordered_map ns"
+              << std::setw(16) << "FlatHashMap ns" << std::setw(12) << "Speedup" << std::endl;
+    for (size_t n : universes) {
+        std::vector<uint64_t> keys(n);
+        for (size_t i = 0; i < n; i++) keys[i] = market::SymbolRegistry::encode("S" + std::to_string(i));
+        market::Xoshiro256PlusPlus rng(9);
+        std::vector<uint64_t> stream(stream_len);
+        for (auto& key : stream) key = keys[rng.next() % n];
+
+        std::unordered_map<uint64_t, SymbolState> std_map;
+        std_map.reserve(n);
+        market::FlatHashMap<uint64_t, SymbolState> flat_map(n);
+        double check_std = 0.0, check_flat = 0.0;
+        double std_ns = runSymbolState(std_map, stream, check_std);
+        double flat_ns = runSymbolState(flat_map, stream, check_flat);
+        if (check_std != check_flat) std::cout << "  ERROR: maps disagree" << std::endl;
+
+        std::cout << "  " << std::setw(10) << n << std::fixed << std::setprecision(2) << std::setw(20) << std_ns
+                  << std::setw(16) << flat_ns << std::setprecision(2) << std::setw(11) << std_ns / flat_ns << "x"
+                  << std::endl;
+    }
+
+    // Order id -> order
+    const size_t steps = 2000000;
+    const size_t live_sizes[] = {10000, 1000000};
+    for (size_t live : live_sizes) {
+        std::cout << "\nOrder id -> order (" << live << " live orders, " << steps
+                  << " add + execute + cancel steps, then hit/miss lookups; ns/op)" << std::endl;
+        std::cout << "  " << std::left << std::setw(30) << "Map" << std::right << std::setw(10) << "Step"
+                  << std::setw(10) << "Hit" << std::setw(10) << "Miss" << std::endl;
+
+        {
+            std::unordered_map<uint64_t, Order> orders;
+            orders.reserve(live + live / 4);
+            printOrderRow("std::unordered_map (reserved)", runOrderBook(live, steps,
+                [&orders](uint64_t id, const Order& o) { orders[id] = o; },
+                [&orders](uint64_t id) -> const Order* {
+                    auto it = orders.find(id);
+                    return it == orders.end() ? nullptr : &it->second;
+                },
+                [&orders](uint64_t id) { orders.erase(id); }));
+        }
+        {
+            market::FlatHashMap<uint64_t, Order> orders(live + live / 4);
+            printOrderRow("FlatHashMap (reserved)", runOrderBook(live, steps,
+                [&orders](uint64_t id, const Order& o) { orders.insert(id, o); },
+                [&orders](uint64_t id) -> const Order* { return orders.find(id); },
+                [&orders](uint64_t id) { orders.erase(id); }));
+            double mean_probe = 0.0;
+            size_t max_probe = 0;
+            orders.probeStats(mean_probe, max_probe);
+            std::cout << "    load " << std::setprecision(2) << orders.loadFactor() << ", mean probe "
+                      << mean_probe << ", max probe " << max_probe << ", "
+                      << orders.getMemoryBytes() / (1024 * 1024) << " MB" << std::endl;
+        }
+    }
+}
+
+} // namespace benchmark
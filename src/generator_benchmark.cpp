@@ -0,0 +1,83 @@
+#include "benchmark.h"
+#include "tick_generator.h"
+#include "tick_batch.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace benchmark {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+void reportRate(const std::string& name, Clock::time_point start, Clock::time_point end,
+                size_t ticks, double checksum) {
+    double seconds = std::chrono::duration<double>(end - start).count();
+    std::cout << "  " << std::left << std::setw(40) << name << std::right
+              << std::fixed << std::setprecision(1) << std::setw(8) << ticks / seconds / 1e6 << " M ticks/sec"
+              << std::setprecision(2) << std::setw(9) << seconds * 1e9 / ticks << " ns/tick"
+              << "  (checksum " << checksum << ")" << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Measure raw tick generation rate for each TickGenerator mode
+ */
+void runGeneratorBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Tick Generator - Generation Rate" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const size_t n = 10000000;
+
+    {
+        market::TickGenerator generator("SPY", 100.0, 0.01, 100, 1000, 42);
+        double checksum = 0.0;
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < n; i++) checksum += generator.generateTick().price;
+        auto t1 = Clock::now();
+        reportRate("generateTick (mt19937, clock/tick)", t0, t1, n, checksum);
+    }
+
+    {
+        market::TickGenerator generator("SPY", 100.0, 0.01, 100, 1000, 42);
+        double checksum = 0.0;
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < n; i++) checksum += generator.generateTickFast().price;
+        auto t1 = Clock::now();
+        reportRate("generateTickFast (clock/tick)", t0, t1, n, checksum);
+    }
+
+    {
+        market::TickGenerator generator("SPY", 100.0, 0.01, 100, 1000, 42);
+        double checksum = 0.0;
+        uint64_t timestamp = market::getCurrentTimeNanos();
+        auto t0 = Clock::now();
+        for (size_t i = 0; i < n; i++) checksum += generator.generateTickFast(timestamp).price;
+        auto t1 = Clock::now();
+        reportRate("generateTickFast (fixed timestamp)", t0, t1, n, checksum);
+    }
+
+    const size_t batch_sizes[] = {256, 4096};
+    for (size_t batch_size : batch_sizes) {
+        for (bool single_timestamp : {false, true}) {
+            market::TickGenerator generator("SPY", 100.0, 0.01, 100, 1000, 42);
+            market::TickBatch batch(batch_size);
+            double checksum = 0.0;
+            auto t0 = Clock::now();
+            for (size_t i = 0; i < n; i += batch_size) {
+                generator.generateBatch(batch, batch_size, single_timestamp);
+                checksum += batch.prices()[batch_size - 1];
+            }
+            auto t1 = Clock::now();
+            reportRate("generateBatch " + std::to_string(batch_size) +
+                           (single_timestamp ? " (clock/batch)" : " (clock/tick)"),
+                       t0, t1, (n + batch_size - 1) / batch_size * batch_size, checksum);
+        }
+    }
+}
+
+} // namespace benchmark
@@ -0,0 +1,195 @@
+#include "benchmark.h"
+#include "benchmark_runner.h"
+#include "polling_ingest.h"
+#include "lockfree_queue.h"
+#include "tick_generator.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+using TickQueue = lockfree::SPSCQueue<market::MarketTick>;
+
+struct ConsumerSide {
+    TickQueue queue;
+    market::AnalyticsEngine analytics{100};
+    LatencyTracker latency;
+    ThroughputMeter throughput;
+};
+
+/**
+ * @brief Write a replay file of ticks from a few symbols
+ */
+void writeReplayFile(const std::string& path, size_t count) {
+    const char* symbols[] = {"AAPL", "MSFT", "NVDA", "QQQ"};
+    std::vector<market::TickGenerator> generators;
+    for (size_t s = 0; s < 4; s++) generators.emplace_back(symbols[s], 100.0 + 50.0 * s, 0.01, 100, 1000, 7 + s);
+    std::vector<market::MarketTick> ticks;
+    ticks.reserve(count);
+    for (size_t i = 0; i < count; i++) ticks.push_back(generators[i % 4].generateTickFast(i));
+    market::ReplayFileSource::write(path, ticks);
+}
+
+/**
+ * @brief Send ticks over UDP in full datagrams, then the end-of-stream marker
+ * @return Ticks the kernel accepted (loopback may still drop on a full receive buffer)
+ */
+size_t sendUdpTicks(uint16_t port, size_t count) {
+    market::UdpTickSender sender(port);
+    market::TickGenerator generator("IWM", 200.0, 0.01, 100, 1000, 11);
+    market::CompactTick datagram[market::UdpSource::kMaxTicksPerDatagram];
+    size_t sent = 0;
+    size_t datagrams = 0;
+    while (sent < count) {
+        size_t n = count - sent < market::UdpSource::kMaxTicksPerDatagram
+            ? count - sent : market::UdpSource::kMaxTicksPerDatagram;
+        for (size_t i = 0; i < n; i++) {
+            datagram[i] = market::CompactTick::fromMarketTick(generator.generateTickFast(sent + i));
+        }
+        if (sender.send(datagram, n)) sent += n;
+        // Stay below what the receiver can drain so loopback does not drop
+        if (++datagrams % 8 == 0) std::this_thread::yield();
+    }
+    return sent;
+}
+
+void printSourceStats(const std::vector<market::IngestSourceStats>& stats) {
+    std::cout << "  " << std::left << std::setw(28) << "Source" << std::right
+              << std::setw(12) << "Polls" << std::setw(12) << "Empty" << std::setw(12) << "Ticks"
+              << std::setw(12) << "Efficiency" << std::setw(12) << "Ticks/poll" << std::setw(10) << "Max"
+              << std::endl;
+    for (const auto& st : stats) {
+        std::string name = st.name.size() > 27 ? st.name.substr(0, 24) + "..." : st.name;
+        std::cout << "  " << std::left << std::setw(28) << name << std::right
+                  << std::setw(12) << st.polls << std::setw(12) << st.emptyPolls() << std::setw(12) << st.ticks
+                  << std::fixed << std::setprecision(1) << std::setw(11) << st.efficiency() * 100.0 << "%"
+                  << std::setw(12) << st.ticksPerProductivePoll() << std::setw(10) << st.max_batch << std::endl;
+    }
+}
+
+/**
+ * @brief Generator (paced), replay file and UDP sources into two consumer queues
+ */
+void runMixedSources(const std::string& replay_path) {
+    const size_t generator_ticks = 200000;
+    const double generator_rate = 1000000.0;
+    const size_t udp_ticks = 100000;
+
+    market::GeneratorSource generator("SPY", generator_ticks, generator_rate);
+    market::ReplayFileSource replay(replay_path);
+    market::UdpSource udp;
+
+    market::IngestConfig config;
+    config.batch_size = 64;
+    config.yield_after_idle = 64;    // Share the CPU on small hosts; 0 for a dedicated core
+    market::PollingIngestLoop<TickQueue> loop(config);
+    loop.addSource(generator);
+    loop.addSource(replay);
+    loop.addSource(udp);
+
+    ConsumerSide sides[2];
+    for (auto& side : sides) loop.addOutput(side.queue);
+
+    std::atomic<bool> ingest_done{false};
+    std::vector<std::thread> consumers;
+    for (auto& side : sides) {
+        consumers.emplace_back(consumerThread<TickQueue, LatencyTracker>, std::ref(side.queue),
+                               std::ref(ingest_done), std::ref(side.analytics), std::ref(side.latency),
+                               std::ref(side.throughput), WaitStrategy::Yield, nullptr, nullptr, nullptr);
+    }
+
+    std::thread ingest([&loop]() { loop.run(); });
+    size_t udp_sent = sendUdpTicks(udp.port(), udp_ticks);
+    // Repeat the end-of-stream marker until the source has seen it
+    {
+        market::UdpTickSender sender(udp.port());
+        while (!udp.endOfStreamReceived()) {
+            sender.finish();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    ingest.join();
+    ingest_done.store(true, std::memory_order_release);
+    for (auto& t : consumers) t.join();
+
+    std::cout << "\nMixed sources -> 2 SPSC queues (batch " << config.batch_size << ", generator paced at "
+              << std::fixed << std::setprecision(0) << generator_rate << " ticks/s)" << std::endl;
+    printSourceStats(loop.getSourceStats());
+    std::cout << "  UDP: " << udp_sent << " ticks sent" << std::endl;
+    std::cout << "  Sweeps: " << loop.getSweeps() << " (" << loop.getIdleSweeps() << " idle), busy "
+              << std::setprecision(1) << loop.getBusyFraction() * 100.0 << "% of "
+              << std::setprecision(3) << loop.getElapsedSeconds() << " s, "
+              << std::setprecision(0) << loop.getTotalTicks() / loop.getElapsedSeconds() << " ticks/s ingested"
+              << std::endl;
+    for (size_t q = 0; q < 2; q++) {
+        std::cout << "  Queue " << q << ": " << sides[q].latency.getCount() << " ticks, ingest->consume P50 "
+                  << std::setprecision(2) << sides[q].latency.getP50() << " μs, P99 "
+                  << sides[q].latency.getP99() << " μs" << std::endl;
+    }
+}
+
+/**
+ * @brief Replay-only ingest rate and poll efficiency per batch size
+ */
+void runBatchSweep(const std::string& replay_path) {
+    std::cout << "\nReplay file -> 1 SPSC queue, batch size sweep" << std::endl;
+    std::cout << "  " << std::right << std::setw(8) << "Batch" << std::setw(16) << "Ingest ticks/s"
+              << std::setw(14) << "Polls" << std::setw(14) << "Ticks/poll" << std::setw(16) << "Consumer P99"
+              << std::endl;
+
+    const size_t batches[] = {1, 8, 64, 256};
+    for (size_t batch : batches) {
+        market::ReplayFileSource replay(replay_path);
+        market::IngestConfig config;
+        config.batch_size = batch;
+        config.yield_after_idle = 64;
+        market::PollingIngestLoop<TickQueue> loop(config);
+        loop.addSource(replay);
+        ConsumerSide side;
+        loop.addOutput(side.queue);
+
+        std::atomic<bool> ingest_done{false};
+        std::thread consumer(consumerThread<TickQueue, LatencyTracker>, std::ref(side.queue),
+                             std::ref(ingest_done), std::ref(side.analytics), std::ref(side.latency),
+                             std::ref(side.throughput), WaitStrategy::Yield, nullptr, nullptr, nullptr);
+        loop.run();
+        ingest_done.store(true, std::memory_order_release);
+        consumer.join();
+
+        const market::IngestSourceStats& st = loop.getSourceStats()[0];
+        std::cout << "  " << std::setw(8) << batch << std::fixed << std::setprecision(0)
+                  << std::setw(16) << st.ticks / loop.getElapsedSeconds()
+                  << std::setw(14) << st.polls << std::setprecision(1) << std::setw(14)
+                  << st.ticksPerProductivePoll() << std::setprecision(2) << std::setw(13)
+                  << side.latency.getP99() << " μs" << std::endl;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Busy-polling ingest from generator, replay file and UDP into SPSC queues
+ */
+void runIngestBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Polling Ingest - Run-to-Completion Loop" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const std::string replay_path = "ingest_replay.bin";
+    writeReplayFile(replay_path, 300000);
+
+    runMixedSources(replay_path);
+    runBatchSweep(replay_path);
+
+    std::remove(replay_path.c_str());
+}
+
+} // namespace benchmark
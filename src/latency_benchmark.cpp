@@ -0,0 +1,72 @@
+#include "benchmark.h"
+#include "benchmark_runner.h"
+#include "market_tick.h"
+#include "lockfree_queue.h"
+#include "mutex_queue.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+void printCurveHeader() {
+    std::cout << "  " << std::left << std::setw(18) << "Queue" << std::right
+              << std::setw(10) << "Target" << std::setw(11) << "Achieved"
+              << std::setw(10) << "P50" << std::setw(10) << "P99"
+              << std::setw(11) << "P999" << std::setw(11) << "Max"
+              << std::setw(9) << "Late %" << std::setw(11) << "Max depth" << std::endl;
+}
+
+void printCurveRow(const std::string& queue, const BenchmarkResults& r, const PacingStats& pacing) {
+    std::cout << "  " << std::left << std::setw(18) << queue << std::right
+              << std::fixed << std::setprecision(2)
+              << std::setw(9) << r.target_tps / 1e6 << "M"
+              << std::setw(10) << r.throughput_tps / 1e6 << "M"
+              << std::setw(10) << r.latency_p50 << std::setw(10) << r.latency_p99
+              << std::setw(11) << r.latency_p999 << std::setw(11) << r.latency_max
+              << std::setw(9) << 100.0 * pacing.late_ticks / std::max<size_t>(r.ticks_processed, 1)
+              << std::setw(11) << r.queue_depth.getMax()
+              << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Sweep open-loop producer rates and report latency vs throughput per queue
+ */
+void runLatencyCurveBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Latency vs Throughput - Open-Loop Producer" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << "Latency measured from intended send time (coordinated-omission corrected), in μs" << std::endl;
+
+    const double rates[] = {100000.0, 500000.0, 1000000.0, 2000000.0, 5000000.0};
+    const double seconds_per_point = 0.5;
+
+    std::vector<BenchmarkResults> all_results;
+    printCurveHeader();
+
+    for (double rate : rates) {
+        size_t n = static_cast<size_t>(rate * seconds_per_point);
+        PacingStats pacing;
+
+        auto lockfree_results = runRateBenchmark<lockfree::SPSCQueue<market::MarketTick>>(
+            "Lock-Free SPSC @" + std::to_string(static_cast<long>(rate)), n, rate, &pacing);
+        printCurveRow("Lock-Free SPSC", lockfree_results, pacing);
+        all_results.push_back(lockfree_results);
+
+        auto mutex_results = runRateBenchmark<lockfree::MutexQueue<market::MarketTick>>(
+            "Mutex Queue @" + std::to_string(static_cast<long>(rate)), n, rate, &pacing);
+        printCurveRow("Mutex Queue", mutex_results, pacing);
+        all_results.push_back(mutex_results);
+    }
+
+    BenchmarkResults::exportToCSV(all_results, "latency_curve.csv");
+    std::cout << "\nResults exported to: latency_curve.csv" << std::endl;
+}
+
+} // namespace benchmark
@@ -1,9 +1,58 @@
 #include <iostream>
+#include <string>
 #include "benchmark.h"
 
 int main(int argc, char* argv[]) {
-    // Run comprehensive benchmarks
-    benchmark::runComprehensiveBenchmarks();
+    std::string mode = argc > 1 ? argv[1] : "queues";
+    
+    if (mode == "queues") {
+        // Run comprehensive benchmarks
+        benchmark::runComprehensiveBenchmarks();
+    } else if (mode == "run") {
+        benchmark::BenchmarkConfig config;
+        std::string error;
+        if (!benchmark::parseBenchmarkArgs(argc - 2, argv + 2, config, error)) {
+            if (!error.empty()) std::cerr << "Error: " << error << "\n" << std::endl;
+            benchmark::printBenchmarkUsage(argv[0]);
+            return error.empty() ? 0 : 1;
+        }
+        return benchmark::runConfiguredBenchmarks(config);
+    } else if (mode == "compare") {
+        return benchmark::runCompare(argc - 2, argv + 2);
+    } else if (mode == "latency") {
+        benchmark::runLatencyCurveBenchmarks();
+    } else if (mode == "placement") {
+        benchmark::runPlacementBenchmarks();
+    } else if (mode == "telemetry") {
+        benchmark::runTelemetryBenchmarks();
+    } else if (mode == "shm") {
+        benchmark::runSharedMemoryBenchmarks();
+    } else if (mode == "quantiles") {
+        benchmark::runQuantileBenchmarks();
+    } else if (mode == "analytics") {
+        benchmark::runAnalyticsBenchmarks();
+    } else if (mode == "snapshots") {
+        benchmark::runSnapshotBenchmarks();
+    } else if (mode == "generator") {
+        benchmark::runGeneratorBenchmarks();
+    } else if (mode == "simulator") {
+        benchmark::runSimulatorBenchmarks();
+    } else if (mode == "arena") {
+        benchmark::runArenaBenchmarks();
+    } else if (mode == "allocators") {
+        benchmark::runAllocatorBenchmarks();
+    } else if (mode == "ingest") {
+        benchmark::runIngestBenchmarks();
+    } else if (mode == "symbols") {
+        benchmark::runSymbolBenchmarks();
+    } else if (mode == "flatmap") {
+        benchmark::runFlatMapBenchmarks();
+    } else if (mode == "quotes") {
+        benchmark::runQuoteBenchmarks();
+    } else {
+        std::cerr << "Usage: " << argv[0] << " [queues|run|compare|latency|placement|telemetry|shm|quantiles|analytics|snapshots|generator|simulator|arena|allocators|ingest|symbols|flatmap|quotes]" << std::endl;
+        return 1;
+    }
     
     return 0;
 }
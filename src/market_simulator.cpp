@@ -0,0 +1,197 @@
+#include "market_simulator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+namespace market {
+
+namespace {
+
+constexpr double kSecondsPerYear = 252.0 * 6.5 * 3600.0;   // Trading seconds
+constexpr double kTwoPi = 6.283185307179586;
+
+} // namespace
+
+SimulatorScenario SimulatorScenario::steady() {
+    SimulatorScenario s;
+    s.name = "steady";
+    return s;
+}
+
+SimulatorScenario SimulatorScenario::openingBurst() {
+    SimulatorScenario s;
+    s.name = "open";
+    s.base_rate_tps = 20000.0;
+    s.open_boost = 4.0;
+    s.open_decay_seconds = 2.0;
+    s.hawkes_alpha = 16000.0;            // Branching ratio α/β = 0.8
+    s.hawkes_beta = 20000.0;             // Excitation half-life ≈ 35 µs
+    s.annual_volatility = 0.45;
+    return s;
+}
+
+SimulatorScenario SimulatorScenario::skewedMomentum() {
+    SimulatorScenario s;
+    s.name = "skewed";
+    s.num_symbols = 500;
+    s.zipf_exponent = 1.4;
+    s.annual_drift = 0.50;
+    s.buy_probability = 0.62;
+    s.volume_log_stddev = 1.5;
+    s.hawkes_alpha = 10000.0;            // Branching ratio 0.5
+    s.hawkes_beta = 20000.0;
+    return s;
+}
+
+SimulatorScenario SimulatorScenario::byName(const std::string& name) {
+    if (name == "open") return openingBurst();
+    if (name == "skewed") return skewedMomentum();
+    return steady();
+}
+
+MarketSimulator::MarketSimulator(const SimulatorScenario& scenario)
+    : scenario_(scenario),
+      rng_(scenario.seed)
+{
+    // Thinning needs a positive intensity, and α ≥ β makes the Hawkes process explode
+    if (!(scenario_.base_rate_tps > 0.0)) {
+        throw std::invalid_argument("MarketSimulator: base_rate_tps must be positive");
+    }
+    if (!(scenario_.hawkes_beta > 0.0)) {
+        throw std::invalid_argument("MarketSimulator: hawkes_beta must be positive");
+    }
+    if (!(scenario_.hawkes_alpha >= 0.0 && scenario_.hawkes_alpha < scenario_.hawkes_beta)) {
+        throw std::invalid_argument("MarketSimulator: hawkes_alpha must be in [0, hawkes_beta)");
+    }
+    if (scenario_.open_boost > 0.0 && !(scenario_.open_decay_seconds > 0.0)) {
+        throw std::invalid_argument("MarketSimulator: open_decay_seconds must be positive");
+    }
+    if (scenario_.num_symbols == 0) scenario_.num_symbols = 1;
+
+    symbols_.reserve(scenario_.num_symbols);
+    char name[32];
+    for (size_t i = 0; i < scenario_.num_symbols; i++) {
+        std::snprintf(name, sizeof(name), "S%04zu", i + 1);
+        symbols_.emplace_back(name);
+    }
+
+    // Zipf CDF over ranks 1..N
+    zipf_cdf_.resize(scenario_.num_symbols);
+    double total = 0.0;
+    for (size_t i = 0; i < scenario_.num_symbols; i++) {
+        total += 1.0 / std::pow(static_cast<double>(i + 1), scenario_.zipf_exponent);
+        zipf_cdf_[i] = total;
+    }
+    for (auto& c : zipf_cdf_) c /= total;
+    zipf_cdf_.back() = 1.0;
+
+    drift_per_second_ = scenario_.annual_drift / kSecondsPerYear;
+    volatility_per_sqrt_second_ = scenario_.annual_volatility / std::sqrt(kSecondsPerYear);
+
+    reset();
+}
+
+void MarketSimulator::reset() {
+    rng_.seed(scenario_.seed);
+    has_cached_normal_ = false;
+    now_seconds_ = 0.0;
+    excitation_ = 0.0;
+    tick_count_ = 0;
+
+    // Initial prices log-uniform between min and max, rounded to cents
+    double log_min = std::log(scenario_.min_base_price);
+    double log_max = std::log(scenario_.max_base_price);
+    prices_.assign(scenario_.num_symbols, 0.0);
+    for (auto& p : prices_) {
+        p = std::round(std::exp(log_min + (log_max - log_min) * uniform()) * 100.0) / 100.0;
+    }
+    last_update_seconds_.assign(scenario_.num_symbols, 0.0);
+}
+
+double MarketSimulator::exponential(double rate) {
+    // 1 - U is in (0, 1], so the log is finite
+    return -std::log(1.0 - uniform()) / rate;
+}
+
+double MarketSimulator::normal() {
+    // Box-Muller rather than std::normal_distribution, whose output differs
+    // between standard libraries and would break seed reproducibility
+    if (has_cached_normal_) {
+        has_cached_normal_ = false;
+        return cached_normal_;
+    }
+    double radius = std::sqrt(-2.0 * std::log(1.0 - uniform()));
+    double angle = kTwoPi * uniform();
+    cached_normal_ = radius * std::sin(angle);
+    has_cached_normal_ = true;
+    return radius * std::cos(angle);
+}
+
+double MarketSimulator::baselineRate(double t) const {
+    double rate = scenario_.base_rate_tps;
+    if (scenario_.open_boost > 0.0) {
+        rate *= 1.0 + scenario_.open_boost * std::exp(-t / scenario_.open_decay_seconds);
+    }
+    return rate;
+}
+
+double MarketSimulator::nextArrival() {
+    // Ogata thinning. Both the baseline and the excitation only decay
+    // between events, so the intensity at the current candidate time is an
+    // upper bound for everything after it.
+    double t = now_seconds_;
+    double excitation = excitation_;
+    for (;;) {
+        double bound = baselineRate(t) + excitation;
+        double wait = exponential(bound);
+        excitation *= std::exp(-scenario_.hawkes_beta * wait);
+        t += wait;
+        double intensity = baselineRate(t) + excitation;
+        if (uniform() * bound <= intensity) break;
+    }
+    excitation_ = excitation + scenario_.hawkes_alpha;
+    return t;
+}
+
+size_t MarketSimulator::pickSymbol() {
+    double u = uniform();
+    auto it = std::upper_bound(zipf_cdf_.begin(), zipf_cdf_.end(), u);
+    if (it == zipf_cdf_.end()) --it;
+    return static_cast<size_t>(it - zipf_cdf_.begin());
+}
+
+MarketTick MarketSimulator::nextTick() {
+    now_seconds_ = nextArrival();
+    size_t idx = pickSymbol();
+
+    // GBM step over the time since this symbol last traded
+    double dt = now_seconds_ - last_update_seconds_[idx];
+    last_update_seconds_[idx] = now_seconds_;
+    double sigma = volatility_per_sqrt_second_;
+    double log_return = (drift_per_second_ - 0.5 * sigma * sigma) * dt +
+                        sigma * std::sqrt(dt) * normal();
+    prices_[idx] *= std::exp(log_return);
+
+    double volume = std::exp(scenario_.volume_log_mean + scenario_.volume_log_stddev * normal());
+    int quantity = std::max(1, static_cast<int>(std::lround(volume)));
+
+    char side = uniform() < scenario_.buy_probability ? 'B' : 'S';
+
+    tick_count_++;
+    return MarketTick(symbols_[idx], std::round(prices_[idx] * 100.0) / 100.0,
+                      quantity, side, getSimulatedTimeNanos());
+}
+
+std::vector<MarketTick> MarketSimulator::generateTicks(size_t count) {
+    std::vector<MarketTick> ticks;
+    ticks.reserve(count);
+
+    for (size_t i = 0; i < count; i++) {
+        ticks.push_back(nextTick());
+    }
+
+    return ticks;
+}
+
+} // namespace market
@@ -0,0 +1,88 @@
+#include "memory_arena.h"
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+#include <system_error>
+
+namespace market {
+
+const char* arenaBackingName(ArenaBacking backing) {
+    switch (backing) {
+        case ArenaBacking::HugeTLB: return "hugetlb 2MB pages";
+        case ArenaBacking::TransparentHuge: return "transparent huge pages";
+        case ArenaBacking::Normal: return "4KB pages";
+        default: return "unknown";
+    }
+}
+
+MemoryArena::MemoryArena(size_t capacity, const ArenaOptions& options)
+    : base_(nullptr), capacity_(0), mapped_(0), offset_(0),
+      backing_(ArenaBacking::Normal), locked_(false), prefaulted_(false) {
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    void* base = MAP_FAILED;
+
+    if (options.huge_pages) {
+        // Reserved huge pages first; fails unless vm.nr_hugepages has room
+        size_t size = (capacity + kHugePageSize - 1) & ~(kHugePageSize - 1);
+        base = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (base != MAP_FAILED) {
+            backing_ = ArenaBacking::HugeTLB;
+            mapped_ = size;
+        } else {
+            // Over-map so the region can start on a 2MB boundary, then trim
+            void* raw = mmap(nullptr, size + kHugePageSize, PROT_READ | PROT_WRITE,
+                             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (raw != MAP_FAILED) {
+                uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+                uintptr_t aligned = (start + kHugePageSize - 1) & ~(uintptr_t(kHugePageSize) - 1);
+                if (aligned > start) munmap(raw, aligned - start);
+                size_t tail = (start + size + kHugePageSize) - (aligned + size);
+                if (tail > 0) munmap(reinterpret_cast<void*>(aligned + size), tail);
+                base = reinterpret_cast<void*>(aligned);
+                mapped_ = size;
+                backing_ = madvise(base, size, MADV_HUGEPAGE) == 0 ? ArenaBacking::TransparentHuge
+                                                                    : ArenaBacking::Normal;
+            }
+        }
+    }
+
+    if (base == MAP_FAILED) {
+        size_t size = (capacity + page - 1) & ~(page - 1);
+        base = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == MAP_FAILED) {
+            throw std::system_error(errno, std::generic_category(), "mmap(arena)");
+        }
+        backing_ = ArenaBacking::Normal;
+        mapped_ = size;
+    }
+
+    base_ = static_cast<char*>(base);
+    capacity_ = mapped_;
+
+    if (options.prefault) {
+        // One write per base page; with huge pages the first write faults in 2MB
+        volatile char* p = base_;
+        for (size_t off = 0; off < mapped_; off += page) p[off] = 0;
+        prefaulted_ = true;
+    }
+    if (options.lock_memory) {
+        locked_ = mlock(base_, mapped_) == 0;
+    }
+}
+
+MemoryArena::~MemoryArena() {
+    if (!base_) return;
+    if (locked_) munlock(base_, mapped_);
+    munmap(base_, mapped_);
+}
+
+std::string MemoryArena::describe() const {
+    std::string s = std::to_string(capacity_ / (1024 * 1024)) + " MB, " + arenaBackingName(backing_);
+    if (prefaulted_) s += ", prefaulted";
+    if (locked_) s += ", locked";
+    return s;
+}
+
+} // namespace market
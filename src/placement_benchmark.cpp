@@ -0,0 +1,96 @@
+#include "benchmark.h"
+#include "benchmark_runner.h"
+#include "benchmark_report.h"
+#include "thread_placement.h"
+#include "lockfree_queue.h"
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+/**
+ * @brief Run one producer/consumer placement a few times and print a row
+ */
+void runPlacement(const std::string& label, int producer_cpu, int consumer_cpu,
+                  size_t num_ticks, size_t repetitions) {
+    RunOptions options;
+    options.producer_cpu = producer_cpu;
+    options.consumer_cpu = consumer_cpu;
+    options.wait = WaitStrategy::Spin;
+
+    // Place queue nodes (allocated by the producer) on the consumer's node
+    CpuTopology topology = CpuTopology::discover();
+    if (const CpuInfo* consumer = topology.find(consumer_cpu)) options.memory_node = consumer->numa_node;
+
+    // One discarded warmup run, then measured repetitions
+    runConfiguredBenchmark<lockfree::SPSCQueue<market::MarketTick>>(label, num_ticks, options);
+    std::vector<BenchmarkResults> runs;
+    for (size_t r = 0; r < repetitions; r++) {
+        runs.push_back(runConfiguredBenchmark<lockfree::SPSCQueue<market::MarketTick>>(label, num_ticks, options));
+    }
+    BenchmarkSummary summary = BenchmarkSummary::fromRuns("lockfree", num_ticks, runs);
+
+    std::string cpus = producer_cpu < 0 ? "-" : std::to_string(producer_cpu) + "," + std::to_string(consumer_cpu);
+    std::cout << "  " << std::left << std::setw(20) << label << std::setw(8) << cpus << std::right
+              << std::fixed << std::setprecision(2)
+              << std::setw(9) << summary.throughput_tps.mean / 1e6 << "M"
+              << std::setw(11) << summary.latency_p50.mean
+              << std::setw(11) << summary.latency_p99.mean
+              << std::setw(11) << summary.latency_p999.mean
+              << std::setw(11) << summary.latency_max.mean << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Compare producer/consumer placements: unpinned, same CPU, SMT siblings, same socket, cross socket
+ */
+void runPlacementBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Thread Placement - Producer/Consumer Affinity" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    CpuTopology topology = CpuTopology::discover();
+    std::cout << "Usable CPUs: " << topology.getCpus().size() << ", packages: "
+              << topology.getPackageCount() << std::endl;
+    std::cout << topology.describe();
+
+    const size_t num_ticks = 500000;
+    const size_t repetitions = 3;
+
+    std::cout << "\nLock-free SPSC, " << num_ticks << " ticks, spin wait, mean of "
+              << repetitions << " runs (latency in μs)" << std::endl;
+    std::cout << "  " << std::left << std::setw(20) << "Placement" << std::setw(8) << "CPUs" << std::right
+              << std::setw(10) << "Ticks/s" << std::setw(11) << "P50" << std::setw(11) << "P99"
+              << std::setw(11) << "P999" << std::setw(11) << "Max" << std::endl;
+
+    runPlacement("Unpinned", -1, -1, num_ticks, repetitions);
+
+    if (!topology.getCpus().empty()) {
+        int cpu = topology.getCpus().front().cpu;
+        runPlacement("Same CPU", cpu, cpu, num_ticks, repetitions);
+    }
+
+    int first, second;
+    if (topology.findSiblingPair(first, second)) {
+        runPlacement("SMT siblings", first, second, num_ticks, repetitions);
+    } else {
+        std::cout << "  SMT siblings        (no hyperthread pair available)" << std::endl;
+    }
+    if (topology.findSameSocketPair(first, second)) {
+        runPlacement("Same socket", first, second, num_ticks, repetitions);
+    } else {
+        std::cout << "  Same socket         (fewer than two cores available)" << std::endl;
+    }
+    if (topology.findCrossSocketPair(first, second)) {
+        runPlacement("Cross socket", first, second, num_ticks, repetitions);
+    } else {
+        std::cout << "  Cross socket        (single package)" << std::endl;
+    }
+}
+
+} // namespace benchmark
@@ -0,0 +1,214 @@
+#include "polling_ingest.h"
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <system_error>
+
+namespace market {
+
+namespace {
+
+[[noreturn]] void throwSystemError(const std::string& what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+sockaddr_in loopback(uint16_t port) {
+    sockaddr_in addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    return addr;
+}
+
+} // namespace
+
+// ---------------------------------------------------------------------------
+// GeneratorSource
+// ---------------------------------------------------------------------------
+
+GeneratorSource::GeneratorSource(const std::string& symbol, size_t total, double rate_tps, unsigned int seed)
+    : generator_(symbol, 100.0, 0.01, 100, 1000, seed), name_("generator:" + symbol), remaining_(total),
+      interval_ns_(rate_tps > 0.0 ? 1e9 / rate_tps : 0.0), start_ns_(0), emitted_(0) {}
+
+size_t GeneratorSource::poll(MarketTick* out, size_t max) {
+    uint64_t now = getCurrentTimeNanos();
+    size_t n = remaining_ < max ? remaining_ : max;
+    if (interval_ns_ > 0.0) {
+        if (start_ns_ == 0) start_ns_ = now;
+        // Ticks due by now under the target rate, less those already sent
+        size_t due = static_cast<size_t>(std::floor((now - start_ns_) / interval_ns_)) + 1;
+        size_t ready = due > emitted_ ? due - emitted_ : 0;
+        if (ready < n) n = ready;
+    }
+    for (size_t i = 0; i < n; i++) out[i] = generator_.generateTickFast(now);
+    remaining_ -= n;
+    emitted_ += n;
+    return n;
+}
+
+// ---------------------------------------------------------------------------
+// ReplayFileSource
+// ---------------------------------------------------------------------------
+
+ReplayFileSource::ReplayFileSource(const std::string& path)
+    : path_(path), records_(nullptr), count_(0), position_(0), mapped_bytes_(0) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) throwSystemError("open(" + path + ")");
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        close(fd);
+        throw std::system_error(err, std::generic_category(), "fstat(" + path + ")");
+    }
+    count_ = static_cast<size_t>(st.st_size) / sizeof(CompactTick);
+    mapped_bytes_ = count_ * sizeof(CompactTick);
+    if (mapped_bytes_ > 0) {
+        void* p = mmap(nullptr, mapped_bytes_, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fd, 0);
+        if (p == MAP_FAILED) {
+            int err = errno;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), "mmap(" + path + ")");
+        }
+        madvise(p, mapped_bytes_, MADV_SEQUENTIAL);
+        records_ = static_cast<const CompactTick*>(p);
+    }
+    close(fd);
+}
+
+ReplayFileSource::~ReplayFileSource() {
+    if (records_) munmap(const_cast<CompactTick*>(records_), mapped_bytes_);
+}
+
+size_t ReplayFileSource::poll(MarketTick* out, size_t max) {
+    size_t n = count_ - position_ < max ? count_ - position_ : max;
+    if (n == 0) return 0;
+    uint64_t now = getCurrentTimeNanos();
+    for (size_t i = 0; i < n; i++) {
+        out[i] = records_[position_ + i].toMarketTick();
+        out[i].timestamp_ns = now;
+    }
+    position_ += n;
+    return n;
+}
+
+void ReplayFileSource::write(const std::string& path, const std::vector<MarketTick>& ticks) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) throwSystemError("open(" + path + ")");
+    std::vector<CompactTick> records;
+    records.reserve(ticks.size());
+    for (const auto& tick : ticks) records.push_back(CompactTick::fromMarketTick(tick));
+
+    const char* data = reinterpret_cast<const char*>(records.data());
+    size_t left = records.size() * sizeof(CompactTick);
+    while (left > 0) {
+        ssize_t written = ::write(fd, data, left);
+        if (written < 0) {
+            if (errno == EINTR) continue;
+            int err = errno;
+            close(fd);
+            throw std::system_error(err, std::generic_category(), "write(" + path + ")");
+        }
+        data += written;
+        left -= static_cast<size_t>(written);
+    }
+    close(fd);
+}
+
+// ---------------------------------------------------------------------------
+// UdpSource / UdpTickSender
+// ---------------------------------------------------------------------------
+
+UdpSource::UdpSource(uint16_t port, int receive_buffer)
+    : fd_(-1), port_(port), finished_(false),
+      buffer_(kMaxDatagramsPerPoll * kMaxTicksPerDatagram), pending_pos_(0) {
+    fd_ = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) throwSystemError("socket(udp)");
+    if (receive_buffer > 0) {
+        // Best effort; capped by net.core.rmem_max
+        setsockopt(fd_, SOL_SOCKET, SO_RCVBUF, &receive_buffer, sizeof(receive_buffer));
+    }
+    sockaddr_in addr = loopback(port);
+    socklen_t len = sizeof(addr);
+    if (bind(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        getsockname(fd_, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+        int err = errno;
+        close(fd_);
+        throw std::system_error(err, std::generic_category(), "bind(udp " + std::to_string(port) + ")");
+    }
+    port_ = ntohs(addr.sin_port);
+    pending_.reserve(buffer_.size());
+}
+
+UdpSource::~UdpSource() {
+    if (fd_ >= 0) close(fd_);
+}
+
+size_t UdpSource::poll(MarketTick* out, size_t max) {
+    if (pending_pos_ == pending_.size() && !finished_.load(std::memory_order_relaxed)) {
+        pending_.clear();
+        pending_pos_ = 0;
+
+        mmsghdr messages[kMaxDatagramsPerPoll];
+        iovec iov[kMaxDatagramsPerPoll];
+        for (size_t i = 0; i < kMaxDatagramsPerPoll; i++) {
+            iov[i].iov_base = &buffer_[i * kMaxTicksPerDatagram];
+            iov[i].iov_len = kMaxTicksPerDatagram * sizeof(CompactTick);
+            std::memset(&messages[i], 0, sizeof(mmsghdr));
+            messages[i].msg_hdr.msg_iov = &iov[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+        int received = recvmmsg(fd_, messages, kMaxDatagramsPerPoll, MSG_DONTWAIT, nullptr);
+        if (received <= 0) return 0;    // EAGAIN: nothing ready
+
+        uint64_t now = getCurrentTimeNanos();
+        for (int m = 0; m < received; m++) {
+            size_t records = messages[m].msg_len / sizeof(CompactTick);
+            if (records == 0) {
+                finished_.store(true, std::memory_order_release);
+                continue;
+            }
+            const CompactTick* first = &buffer_[static_cast<size_t>(m) * kMaxTicksPerDatagram];
+            for (size_t r = 0; r < records; r++) {
+                pending_.push_back(first[r].toMarketTick());
+                pending_.back().timestamp_ns = now;
+            }
+        }
+    }
+
+    size_t n = pending_.size() - pending_pos_;
+    if (n > max) n = max;
+    for (size_t i = 0; i < n; i++) out[i] = std::move(pending_[pending_pos_ + i]);
+    pending_pos_ += n;
+    return n;
+}
+
+UdpTickSender::UdpTickSender(uint16_t port) : fd_(-1) {
+    fd_ = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) throwSystemError("socket(udp)");
+    sockaddr_in addr = loopback(port);
+    if (connect(fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        int err = errno;
+        close(fd_);
+        throw std::system_error(err, std::generic_category(), "connect(udp " + std::to_string(port) + ")");
+    }
+}
+
+UdpTickSender::~UdpTickSender() {
+    if (fd_ >= 0) close(fd_);
+}
+
+bool UdpTickSender::send(const CompactTick* ticks, size_t count) {
+    if (count > UdpSource::kMaxTicksPerDatagram) count = UdpSource::kMaxTicksPerDatagram;
+    ssize_t sent = ::send(fd_, ticks, count * sizeof(CompactTick), 0);
+    return sent == static_cast<ssize_t>(count * sizeof(CompactTick));
+}
+
+} // namespace market
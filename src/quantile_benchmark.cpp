@@ -0,0 +1,191 @@
+#include "benchmark.h"
+#include "benchmark_runner.h"
+#include "quantile_sketch.h"
+#include "analytics.h"
+#include "lockfree_queue.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+/**
+ * @brief Exact quantile using the same index rule as LatencyTracker
+ */
+double exactQuantile(const std::vector<double>& sorted, double q) {
+    size_t index = static_cast<size_t>(q * sorted.size());
+    if (index >= sorted.size()) index = sorted.size() - 1;
+    return sorted[index];
+}
+
+/**
+ * @brief Rank error: |rank(estimate) / n - q|
+ */
+double rankError(const std::vector<double>& sorted, double estimate, double q) {
+    auto it = std::lower_bound(sorted.begin(), sorted.end(), estimate);
+    double rank = static_cast<double>(it - sorted.begin()) / sorted.size();
+    return std::fabs(rank - q);
+}
+
+void reportAccuracy(const std::string& name, const std::vector<double>& samples, double compression) {
+    market::TDigest digest(compression);
+    for (double v : samples) digest.add(v);
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::cout << std::defaultfloat << "\n" << name << " (" << samples.size() << " samples, compression "
+              << compression << ", " << digest.getCentroidCount() << " centroids, "
+              << digest.getMemoryBytes() << " bytes)" << std::endl;
+    std::cout << "  Quantile      Exact       Sketch      RelErr%    RankErr" << std::endl;
+
+    const double quantiles[] = {0.5, 0.9, 0.99, 0.999, 0.9999};
+    for (double q : quantiles) {
+        double exact = exactQuantile(sorted, q);
+        double estimate = digest.quantile(q);
+        double rel = exact != 0.0 ? std::fabs(estimate - exact) / std::fabs(exact) * 100.0 : 0.0;
+        std::cout << "  " << std::setw(8) << std::fixed << std::setprecision(4) << q
+                  << std::setw(12) << std::setprecision(3) << exact
+                  << std::setw(12) << estimate
+                  << std::setw(11) << std::setprecision(4) << rel
+                  << std::setw(11) << std::setprecision(6) << rankError(sorted, estimate, q)
+                  << std::endl;
+    }
+}
+
+void reportThroughput(const std::vector<double>& samples) {
+    using clock = std::chrono::steady_clock;
+
+    // Exact: retain everything then sort once per query (LatencyTracker)
+    auto t0 = clock::now();
+    LatencyTracker exact;
+    for (double v : samples) exact.addLatency(v);
+    auto t1 = clock::now();
+    volatile double exact_p99 = exact.getP99();
+    auto t2 = clock::now();
+
+    auto t3 = clock::now();
+    SketchLatencyTracker sketch;
+    for (double v : samples) sketch.addLatency(v);
+    auto t4 = clock::now();
+    volatile double sketch_p99 = sketch.getP99();
+    auto t5 = clock::now();
+    (void)exact_p99;
+    (void)sketch_p99;
+
+    double n = static_cast<double>(samples.size());
+    auto ns = [](clock::duration d) { return std::chrono::duration<double, std::nano>(d).count(); };
+
+    std::cout << "\nThroughput (" << samples.size() << " samples)" << std::endl;
+    std::cout << std::setprecision(2);
+    std::cout << "  Exact sort:  insert " << ns(t1 - t0) / n << " ns/sample, P99 query "
+              << ns(t2 - t1) / 1e6 << " ms, memory " << samples.size() * sizeof(double) << " bytes" << std::endl;
+    std::cout << "  t-digest:    insert " << ns(t4 - t3) / n << " ns/sample, P99 query "
+              << ns(t5 - t4) / 1e6 << " ms" << std::endl;
+}
+
+void reportMerge(const std::vector<double>& samples) {
+    // Simulate per-consumer sketches combined at report time
+    const size_t shards = 8;
+    std::vector<market::TDigest> parts(shards, market::TDigest(200.0));
+    for (size_t i = 0; i < samples.size(); i++) parts[i % shards].add(samples[i]);
+
+    market::TDigest combined(200.0);
+    for (const auto& p : parts) combined.merge(p);
+
+    std::vector<double> sorted = samples;
+    std::sort(sorted.begin(), sorted.end());
+
+    std::cout << "\nMerged from " << shards << " shards: P99 rank error "
+              << std::setprecision(6) << rankError(sorted, combined.quantile(0.99), 0.99)
+              << ", P999 rank error " << rankError(sorted, combined.quantile(0.999), 0.999) << std::endl;
+}
+
+/**
+ * @brief Check that centroid count and memory stay bounded on a long stream
+ *
+ * Uniform input puts as much weight in the tails as anywhere, so a
+ * compression that mishandles the top of the scale shows up here first.
+ */
+void reportBoundedSize(double compression, size_t samples) {
+    market::TDigest digest(compression);
+    const size_t initial_bytes = digest.getMemoryBytes();
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> dist(0.0, 1000.0);
+
+    size_t max_centroids = 0;
+    for (size_t i = 1; i <= samples; i++) {
+        digest.add(dist(rng));
+        if ((i & 0xfffff) == 0) max_centroids = std::max(max_centroids, digest.getCentroidCount());
+    }
+    max_centroids = std::max(max_centroids, digest.getCentroidCount());
+
+    const size_t bound = static_cast<size_t>(std::ceil(compression)) + 2;
+    std::cout << "\nBounded size (" << samples << " uniform samples, compression " << std::defaultfloat
+              << compression << "): max " << max_centroids << " centroids (bound " << bound << "), "
+              << digest.getMemoryBytes() << " bytes (" << initial_bytes << " at construction)" << std::endl;
+    if (max_centroids > bound || digest.getMemoryBytes() != initial_bytes) {
+        std::cout << "  ERROR: t-digest grew past its fixed budget" << std::endl;
+    }
+}
+
+} // namespace
+
+/**
+ * @brief Compare t-digest quantile accuracy and throughput against exact sorting
+ */
+void runQuantileBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Streaming Quantiles - t-digest vs Exact" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const size_t n = 1000000;
+    std::mt19937_64 rng(42);
+
+    std::vector<double> uniform(n);
+    std::uniform_real_distribution<double> uniform_dist(0.0, 1000.0);
+    for (auto& v : uniform) v = uniform_dist(rng);
+
+    // Latency-like: heavy right tail
+    std::vector<double> lognormal(n);
+    std::lognormal_distribution<double> lognormal_dist(1.0, 1.0);
+    for (auto& v : lognormal) v = lognormal_dist(rng);
+
+    // Price-like: random walk around 100
+    std::vector<double> prices(n);
+    double price = 100.0;
+    std::uniform_real_distribution<double> step(-0.01, 0.01);
+    for (auto& v : prices) {
+        price += step(rng);
+        v = price;
+    }
+
+    reportAccuracy("Uniform", uniform, 100.0);
+    reportAccuracy("Uniform", uniform, 200.0);
+    reportAccuracy("Lognormal latency", lognormal, 100.0);
+    reportAccuracy("Lognormal latency", lognormal, 200.0);
+    reportAccuracy("Random-walk price", prices, 100.0);
+
+    reportThroughput(lognormal);
+    reportMerge(lognormal);
+    reportBoundedSize(100.0, 20000000);
+
+    // End-to-end: exact vs sketch latency backend in the pipeline
+    std::vector<BenchmarkResults> all_results;
+    all_results.push_back(runBenchmark<lockfree::SPSCQueue<market::MarketTick>, LatencyTracker>(
+        "Lock-Free SPSC + Exact Latency (" + std::to_string(n) + ")", n));
+    all_results.push_back(runBenchmark<lockfree::SPSCQueue<market::MarketTick>, SketchLatencyTracker>(
+        "Lock-Free SPSC + t-digest Latency (" + std::to_string(n) + ")", n));
+
+    BenchmarkResults::exportToCSV(all_results, "quantile_benchmark_results.csv");
+    std::cout << "\nResults exported to: quantile_benchmark_results.csv" << std::endl;
+}
+
+} // namespace benchmark
@@ -0,0 +1,357 @@
+// Queue microbenchmarks: isolate queue cost from tick generation, analytics
+// and per-tick clock reads, which the end-to-end benchmarks mix together.
+// Built as a separate executable (queue_microbench).
+
+#include "market_tick.h"
+#include "lockfree_queue.h"
+#include "mutex_queue.h"
+#include "shm_queue.h"
+#include "thread_placement.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace benchmark {
+
+namespace {
+
+using Message = market::CompactTick;
+
+inline uint64_t nowNanos() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+/**
+ * @brief Spin briefly, then yield, so a waiting thread cannot starve its peer on a shared core
+ */
+inline void backoff(unsigned& spins) {
+    if (++spins < 64) {
+#if defined(__x86_64__) || defined(__i386__)
+        _mm_pause();
+#endif
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * @brief Pair of endpoints for an in-process queue (both ends are the same object)
+ */
+template<typename QueueType>
+class InProcessEndpoints {
+private:
+    QueueType queue_;
+
+public:
+    static const char* name();
+    explicit InProcessEndpoints(size_t /*capacity*/) {}
+    bool push(const Message& m) { queue_.push(m); return true; }
+    bool pop(Message& out) {
+        auto m = queue_.pop();
+        if (!m) return false;
+        out = *m;
+        return true;
+    }
+};
+
+template<> const char* InProcessEndpoints<lockfree::SPSCQueue<Message>>::name() { return "SPSCQueue"; }
+template<> const char* InProcessEndpoints<lockfree::MutexQueue<Message>>::name() { return "MutexQueue"; }
+
+/**
+ * @brief Shared-memory ring used in-process: producer handle from create(), consumer from attach()
+ */
+class ShmEndpoints {
+private:
+    std::string name_;
+    std::unique_ptr<lockfree::ShmSPSCQueue<Message>> producer_;
+    std::unique_ptr<lockfree::ShmSPSCQueue<Message>> consumer_;
+
+public:
+    static const char* name() { return "ShmSPSCQueue"; }
+
+    explicit ShmEndpoints(size_t capacity) {
+        static std::atomic<int> counter{0};
+        name_ = "/mdfh_microbench_" + std::to_string(getpid()) + "_" + std::to_string(counter++);
+        producer_ = lockfree::ShmSPSCQueue<Message>::create(name_, capacity);
+        consumer_ = lockfree::ShmSPSCQueue<Message>::attach(name_);
+    }
+
+    ~ShmEndpoints() { lockfree::ShmSPSCQueue<Message>::unlink(name_); }
+
+    bool push(const Message& m) { return producer_->tryPush(m); }
+    bool pop(Message& out) {
+        auto m = consumer_->pop();
+        if (!m) return false;
+        out = *m;
+        return true;
+    }
+};
+
+struct MicrobenchOptions {
+    size_t ops = 2000000;
+    size_t round_trips = 100000;
+    size_t capacity = 65536;        // Ring size for bounded queues
+    int producer_cpu = -1;
+    int consumer_cpu = -1;
+};
+
+template<typename Endpoints>
+void pushBlocking(Endpoints& q, const Message& m) {
+    unsigned spins = 0;
+    while (!q.push(m)) backoff(spins);
+}
+
+template<typename Endpoints>
+void popBlocking(Endpoints& q, Message& out) {
+    unsigned spins = 0;
+    while (!q.pop(out)) backoff(spins);
+}
+
+double percentile(std::vector<uint64_t>& samples, double p) {
+    if (samples.empty()) return 0.0;
+    size_t index = std::min(samples.size() - 1, static_cast<size_t>(p * samples.size()));
+    std::nth_element(samples.begin(), samples.begin() + index, samples.end());
+    return static_cast<double>(samples[index]);
+}
+
+/**
+ * @brief Producer pushes ops messages flat out; consumer pops them all
+ */
+template<typename Endpoints>
+void runOneWayThroughput(const MicrobenchOptions& opt) {
+    Endpoints q(opt.capacity);
+    Message m{};
+    uint64_t start = 0, end = 0;
+
+    std::thread consumer([&]() {
+        pinCurrentThread(opt.consumer_cpu);
+        Message out;
+        for (size_t i = 0; i < opt.ops; i++) popBlocking(q, out);
+        end = nowNanos();
+    });
+
+    pinCurrentThread(opt.producer_cpu);
+    start = nowNanos();
+    for (size_t i = 0; i < opt.ops; i++) {
+        m.timestamp_ns = i;
+        pushBlocking(q, m);
+    }
+    consumer.join();
+
+    double seconds = (end - start) / 1e9;
+    std::cout << "  " << std::left << std::setw(14) << Endpoints::name() << std::right << std::fixed
+              << std::setprecision(2) << std::setw(10) << opt.ops / seconds / 1e6 << " M msg/s"
+              << std::setw(10) << (end - start) / static_cast<double>(opt.ops) << " ns/msg" << std::endl;
+}
+
+/**
+ * @brief Round trip over two queues: A -> B on the first, B -> A on the second
+ */
+template<typename Endpoints>
+void runPingPong(const MicrobenchOptions& opt) {
+    Endpoints ping(opt.capacity);
+    Endpoints pong(opt.capacity);
+    std::vector<uint64_t> rtt(opt.round_trips);
+
+    std::thread echo([&]() {
+        pinCurrentThread(opt.consumer_cpu);
+        Message m;
+        for (size_t i = 0; i < opt.round_trips; i++) {
+            popBlocking(ping, m);
+            pushBlocking(pong, m);
+        }
+    });
+
+    pinCurrentThread(opt.producer_cpu);
+    Message m{};
+    Message reply;
+    for (size_t i = 0; i < opt.round_trips; i++) {
+        uint64_t t0 = nowNanos();
+        pushBlocking(ping, m);
+        popBlocking(pong, reply);
+        rtt[i] = nowNanos() - t0;
+    }
+    echo.join();
+
+    double p50 = percentile(rtt, 0.50);
+    double p99 = percentile(rtt, 0.99);
+    double p999 = percentile(rtt, 0.999);
+    std::cout << "  " << std::left << std::setw(14) << Endpoints::name() << std::right << std::fixed
+              << std::setprecision(0) << "  RTT P50 " << std::setw(8) << p50 << " ns"
+              << "  P99 " << std::setw(9) << p99 << " ns"
+              << "  P999 " << std::setw(9) << p999 << " ns" << std::endl;
+}
+
+/**
+ * @brief Push bursts back to back, then wait for the consumer to drain each one
+ *
+ * Reports how long the producer spent pushing the burst (stalls when a
+ * bounded queue fills) and how long until the consumer had drained it.
+ */
+template<typename Endpoints>
+void runBurst(const MicrobenchOptions& opt, size_t burst, size_t bursts) {
+    Endpoints q(opt.capacity);
+    std::atomic<uint64_t> consumed{0};
+    std::atomic<bool> stop{false};
+
+    std::thread consumer([&]() {
+        pinCurrentThread(opt.consumer_cpu);
+        Message out;
+        unsigned spins = 0;
+        while (!stop.load(std::memory_order_acquire)) {
+            if (q.pop(out)) {
+                consumed.fetch_add(1, std::memory_order_release);
+                spins = 0;
+            } else {
+                backoff(spins);
+            }
+        }
+    });
+
+    pinCurrentThread(opt.producer_cpu);
+    std::vector<uint64_t> push_ns, drain_ns;
+    Message m{};
+    uint64_t sent = 0;
+    for (size_t b = 0; b < bursts; b++) {
+        uint64_t t0 = nowNanos();
+        for (size_t i = 0; i < burst; i++) pushBlocking(q, m);
+        uint64_t t1 = nowNanos();
+        sent += burst;
+        unsigned spins = 0;
+        while (consumed.load(std::memory_order_acquire) < sent) backoff(spins);
+        uint64_t t2 = nowNanos();
+        push_ns.push_back(t1 - t0);
+        drain_ns.push_back(t2 - t0);
+    }
+    stop.store(true, std::memory_order_release);
+    consumer.join();
+
+    std::cout << "  " << std::left << std::setw(14) << Endpoints::name() << std::right
+              << "  burst " << std::setw(6) << burst << std::fixed << std::setprecision(1)
+              << "  push " << std::setw(8) << percentile(push_ns, 0.5) / burst << " ns/msg"
+              << "  drain P50 " << std::setw(10) << percentile(drain_ns, 0.5) / 1000.0 << " μs"
+              << "  P99 " << std::setw(10) << percentile(drain_ns, 0.99) / 1000.0 << " μs" << std::endl;
+}
+
+/**
+ * @brief Hold a fixed number of messages in flight and measure per-message latency
+ */
+template<typename Endpoints>
+void runDepthLatency(const MicrobenchOptions& opt, size_t depth) {
+    Endpoints q(std::max(opt.capacity, depth));
+    std::atomic<uint64_t> received{0};
+    const size_t n = std::min<size_t>(opt.ops, 500000);
+    std::vector<uint64_t> latency(n);
+
+    std::thread consumer([&]() {
+        pinCurrentThread(opt.consumer_cpu);
+        Message out;
+        for (size_t i = 0; i < n; i++) {
+            popBlocking(q, out);
+            latency[i] = nowNanos() - out.timestamp_ns;
+            received.store(i + 1, std::memory_order_release);
+        }
+    });
+
+    pinCurrentThread(opt.producer_cpu);
+    Message m{};
+    for (size_t i = 0; i < n; i++) {
+        unsigned spins = 0;
+        while (i - received.load(std::memory_order_acquire) >= depth) backoff(spins);
+        m.timestamp_ns = nowNanos();
+        pushBlocking(q, m);
+    }
+    consumer.join();
+
+    std::cout << "  " << std::left << std::setw(14) << Endpoints::name() << std::right
+              << "  depth " << std::setw(5) << depth << std::fixed << std::setprecision(0)
+              << "  P50 " << std::setw(9) << percentile(latency, 0.50) << " ns"
+              << "  P99 " << std::setw(9) << percentile(latency, 0.99) << " ns"
+              << "  P999 " << std::setw(9) << percentile(latency, 0.999) << " ns" << std::endl;
+}
+
+/**
+ * @brief Run every test for one queue type
+ */
+template<typename Endpoints>
+void runSuite(const MicrobenchOptions& opt, const std::string& test) {
+    if (test == "all" || test == "throughput") runOneWayThroughput<Endpoints>(opt);
+    if (test == "all" || test == "pingpong") runPingPong<Endpoints>(opt);
+    if (test == "all" || test == "burst") {
+        for (size_t burst : {64, 1024, 16384}) runBurst<Endpoints>(opt, burst, 50);
+    }
+    if (test == "all" || test == "depth") {
+        for (size_t depth : {1, 16, 256, 4096}) runDepthLatency<Endpoints>(opt, depth);
+    }
+}
+
+void printUsage(const char* program) {
+    std::cout << "Usage: " << program << " [options]\n"
+              << "  --test NAME     throughput, pingpong, burst, depth or all (default all)\n"
+              << "  --queue NAME    spsc, mutex, shm or all (default all)\n"
+              << "  --ops N         Messages for throughput/depth tests (default 2000000)\n"
+              << "  --round-trips N Ping-pong iterations (default 100000)\n"
+              << "  --capacity N    Ring capacity for bounded queues (default 65536)\n"
+              << "  --pin P,C       Pin producer/initiator to CPU P, consumer/echo to CPU C\n";
+}
+
+} // namespace
+
+} // namespace benchmark
+
+int main(int argc, char* argv[]) {
+    using namespace benchmark;
+
+    MicrobenchOptions opt;
+    std::string test = "all";
+    std::string queue = "all";
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-h" || arg == "--help" || i + 1 >= argc) {
+            printUsage(argv[0]);
+            return arg == "-h" || arg == "--help" ? 0 : 1;
+        }
+        std::string value = argv[++i];
+        if (arg == "--test") test = value;
+        else if (arg == "--queue") queue = value;
+        else if (arg == "--ops") opt.ops = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--round-trips") opt.round_trips = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--capacity") opt.capacity = std::strtoull(value.c_str(), nullptr, 10);
+        else if (arg == "--pin") {
+            size_t comma = value.find(',');
+            if (comma == std::string::npos) {
+                printUsage(argv[0]);
+                return 1;
+            }
+            opt.producer_cpu = std::atoi(value.substr(0, comma).c_str());
+            opt.consumer_cpu = std::atoi(value.substr(comma + 1).c_str());
+        } else {
+            printUsage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Queue Microbenchmarks (" << sizeof(Message) << "-byte messages)" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    if (queue == "all" || queue == "spsc") runSuite<InProcessEndpoints<lockfree::SPSCQueue<Message>>>(opt, test);
+    if (queue == "all" || queue == "mutex") runSuite<InProcessEndpoints<lockfree::MutexQueue<Message>>>(opt, test);
+    if (queue == "all" || queue == "shm") runSuite<ShmEndpoints>(opt, test);
+
+    return 0;
+}
@@ -0,0 +1,181 @@
+#include "benchmark.h"
+#include "analytics.h"
+#include "fast_rng.h"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr double kTickSize = 0.01;
+constexpr uint64_t kHorizonNs = 100000;     // Realized spread measured 100 μs after each trade
+
+/**
+ * @brief One symbol's interleaved quote and trade updates, in arrival order
+ */
+struct EventStream {
+    std::vector<uint8_t> is_quote;
+    std::vector<market::MarketQuote> quotes;
+    std::vector<market::MarketTick> trades;
+};
+
+/**
+ * @brief Synthetic quote/trade stream with a known true side for every trade
+ *
+ * The mid walks on a one-cent grid with a 1-3 tick spread. Buyers lift the
+ * offer and sellers hit the bid, except one trade in five that prints at
+ * the mid (where Lee-Ready falls back to the tick test); a third of trades
+ * move the mid a tick their way, so realized spreads come out below
+ * effective spreads.
+ */
+EventStream makeStream(size_t events, uint64_t trade_every, uint64_t seed) {
+    market::Xoshiro256PlusPlus rng(seed);
+    EventStream stream;
+    stream.is_quote.reserve(events);
+    stream.quotes.reserve(events);
+    stream.trades.reserve(events / trade_every + 1);
+
+    int64_t mid_ticks2 = 2 * 10000;    // Mid in half-ticks, so odd spreads stay on the grid
+    int64_t spread_ticks = 1;
+    uint64_t ts = 1000000000ULL;
+    for (size_t i = 0; i < events; i++) {
+        uint64_t r = rng.next();
+        ts += 1 + (r & 1023);
+        double bid = (mid_ticks2 - spread_ticks) * 0.5 * kTickSize;
+        double ask = (mid_ticks2 + spread_ticks) * 0.5 * kTickSize;
+
+        if ((r >> 10) % trade_every == 0) {
+            bool buy = (r >> 20) & 1;
+            double price = ((r >> 21) % 5 == 0) ? 0.5 * (bid + ask) : (buy ? ask : bid);
+            int volume = static_cast<int>(100 * (1 + ((r >> 24) & 7)));
+            stream.trades.emplace_back("SPY", price, volume, buy ? 'B' : 'S', ts);
+            stream.is_quote.push_back(0);
+            if ((r >> 27) % 3 == 0) mid_ticks2 += buy ? 2 : -2;
+        } else {
+            // Quote update: random walk in the mid, new spread and sizes
+            uint64_t move = (r >> 20) % 16;
+            if (move == 0) mid_ticks2 += 2;
+            else if (move == 1) mid_ticks2 -= 2;
+            spread_ticks = 1 + static_cast<int64_t>((r >> 23) % 3);
+            // Keep the mid on the half-tick grid that matches the spread's parity
+            if ((mid_ticks2 + spread_ticks) & 1) mid_ticks2 += ((r >> 34) & 1) ? 1 : -1;
+            int bid_size = static_cast<int>(100 * (1 + ((r >> 26) & 15)));
+            int ask_size = static_cast<int>(100 * (1 + ((r >> 30) & 15)));
+            stream.quotes.emplace_back("SPY", (mid_ticks2 - spread_ticks) * 0.5 * kTickSize,
+                                       (mid_ticks2 + spread_ticks) * 0.5 * kTickSize, bid_size, ask_size, ts);
+            stream.is_quote.push_back(1);
+        }
+    }
+    return stream;
+}
+
+/**
+ * @brief Feed the whole stream to an engine; returns ns/event
+ */
+double runEngine(market::AnalyticsEngine& engine, const EventStream& stream) {
+    size_t qi = 0, ti = 0;
+    auto start = Clock::now();
+    for (size_t i = 0; i < stream.is_quote.size(); i++) {
+        if (stream.is_quote[i]) {
+            engine.processQuote(stream.quotes[qi++]);
+        } else {
+            engine.processTick(stream.trades[ti++]);
+        }
+    }
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / stream.is_quote.size();
+}
+
+/**
+ * @brief Trade-to-quote calculators alone, without the rest of the engine; returns ns/event
+ */
+double runQuoteCalculators(const EventStream& stream, double& check) {
+    market::MicropriceCalculator quote;
+    market::OrderFlowImbalanceCalculator ofi(100);
+    market::TradeSignClassifier signs;
+    market::SpreadCalculator spreads(kHorizonNs);
+    size_t qi = 0, ti = 0;
+    auto start = Clock::now();
+    for (size_t i = 0; i < stream.is_quote.size(); i++) {
+        if (stream.is_quote[i]) {
+            const market::MarketQuote& q = stream.quotes[qi++];
+            spreads.addQuote(q);
+            quote.addQuote(q);
+            ofi.addQuote(q);
+        } else {
+            const market::MarketTick& t = stream.trades[ti++];
+            int sign = signs.addTick(t, quote.getMid());
+            spreads.addTrade(t.price, t.volume, sign, t.timestamp_ns);
+        }
+    }
+    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / stream.is_quote.size();
+    check = quote.getMicroprice() + static_cast<double>(ofi.getOFI()) + spreads.getEffectiveSpread();
+    return ns;
+}
+
+void printRateRow(const std::string& label, double ns) {
+    std::cout << "  " << std::left << std::setw(40) << label << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << ns << std::setprecision(2) << std::setw(14) << 1000.0 / ns << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Quote + trade event rates through AnalyticsEngine and the trade-to-quote calculators
+ */
+void runQuoteBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Trade-to-Quote Analytics - Event Rates" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const size_t events = 2000000;
+    const uint64_t mixes[] = {2, 4, 10};    // One trade per N events
+
+    for (uint64_t trade_every : mixes) {
+        EventStream stream = makeStream(events, trade_every, 17);
+        std::cout << "\n" << events << " events: " << stream.quotes.size() << " quotes, " << stream.trades.size()
+                  << " trades (1 trade per " << trade_every << " events)" << std::endl;
+        std::cout << "  " << std::left << std::setw(40) << "Path" << std::right << std::setw(10) << "ns/event"
+                  << std::setw(14) << "M events/s" << std::endl;
+
+        double check = 0.0;
+        printRateRow("Quote calculators only", runQuoteCalculators(stream, check));
+
+        market::AnalyticsEngine engine(100, 1000, 0.05, 1000000000ULL, 100, kHorizonNs);
+        printRateRow("AnalyticsEngine (quotes + trades)", runEngine(engine, stream));
+        if (check == 0.0) std::cout << "  ERROR: calculators produced nothing" << std::endl;
+
+        if (trade_every == 4) {
+            std::cout << "  Mid " << std::setprecision(4) << engine.getMidPrice() << ", microprice "
+                      << engine.getMicroprice() << ", quoted spread " << engine.getQuotedSpread()
+                      << " (time-weighted " << engine.getTimeWeightedSpread() << ")" << std::endl;
+            std::cout << "  Effective spread " << engine.getEffectiveSpread() << " (" << std::setprecision(3)
+                      << engine.getEffectiveSpreadBps() << " bps), realized " << std::setprecision(4)
+                      << engine.getRealizedSpread() << ", price impact " << engine.getPriceImpact() << std::endl;
+            std::cout << "  OFI " << engine.getOrderFlowImbalance() << " (last 100 quotes "
+                      << engine.getRollingOrderFlowImbalance() << ")" << std::endl;
+            std::cout << "  Lee-Ready agreement with true side " << std::setprecision(1)
+                      << engine.getClassificationAgreement() * 100.0 << "%, classified imbalance "
+                      << engine.getClassifiedImbalance() << " vs reported " << engine.getImbalance() << std::endl;
+        }
+    }
+
+    // Baseline: the same trades with no quotes, so only the tick test runs
+    EventStream stream = makeStream(events, 4, 17);
+    EventStream trades_only;
+    trades_only.trades = stream.trades;
+    trades_only.is_quote.assign(trades_only.trades.size(), 0);
+    market::AnalyticsEngine engine(100, 1000, 0.05, 1000000000ULL, 100, kHorizonNs);
+    std::cout << "\nTrades only, no quotes (" << trades_only.trades.size() << " trades)" << std::endl;
+    printRateRow("AnalyticsEngine processTick", runEngine(engine, trades_only));
+    std::cout << "  Tick-test agreement with true side " << std::setprecision(1)
+              << engine.getClassificationAgreement() * 100.0 << "%" << std::endl;
+}
+
+} // namespace benchmark
@@ -0,0 +1,242 @@
+#include "benchmark.h"
+#include "benchmark_runner.h"
+#include "market_tick.h"
+#include "tick_generator.h"
+#include "analytics.h"
+#include "lockfree_queue.h"
+#include "shm_queue.h"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace benchmark {
+
+namespace {
+
+/**
+ * @brief Plain-data results sent from the consumer process over a pipe
+ */
+struct ShmConsumerReport {
+    size_t ticks_processed;
+    double throughput_tps;
+    double latency_mean;
+    double latency_p50;
+    double latency_p99;
+    double latency_p999;
+    double latency_min;
+    double latency_max;
+    double elapsed_seconds;
+};
+
+bool writeAll(int fd, const void* data, size_t len) {
+    const char* p = static_cast<const char*>(data);
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n <= 0) return false;
+        p += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+bool readAll(int fd, void* data, size_t len) {
+    char* p = static_cast<char*>(data);
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n <= 0) return false;
+        p += n;
+        len -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * @brief Body of the forked consumer process: attach, consume, report
+ */
+[[noreturn]] void runShmConsumerProcess(const std::string& shm_name, size_t num_ticks,
+                                        int ready_fd, int report_fd) {
+    int status = 0;
+    try {
+        auto queue = lockfree::ShmSPSCQueue<market::CompactTick>::attach(shm_name);
+
+        market::AnalyticsEngine analytics(100);
+        LatencyTracker latency_tracker;
+        ThroughputMeter throughput;
+
+        char ready = 1;
+        writeAll(ready_fd, &ready, 1);
+
+        throughput.start();
+        size_t received = 0;
+        while (received < num_ticks) {
+            auto tick_opt = queue->pop();
+            if (tick_opt.has_value()) {
+                uint64_t now = market::getCurrentTimeNanos();
+                latency_tracker.addLatency(market::calculateLatencyMicros(tick_opt->timestamp_ns, now));
+                analytics.processTick(tick_opt->toMarketTick());
+                throughput.addItem();
+                received++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        throughput.stop();
+
+        ShmConsumerReport report{};
+        report.ticks_processed = latency_tracker.getCount();
+        report.throughput_tps = throughput.getThroughput();
+        report.latency_mean = latency_tracker.getMean();
+        report.latency_p50 = latency_tracker.getP50();
+        report.latency_p99 = latency_tracker.getP99();
+        report.latency_p999 = latency_tracker.getP999();
+        report.latency_min = latency_tracker.getMin();
+        report.latency_max = latency_tracker.getMax();
+        report.elapsed_seconds = throughput.getElapsedSeconds();
+        if (!writeAll(report_fd, &report, sizeof(report))) status = 1;
+    } catch (const std::exception& e) {
+        std::cerr << "  Consumer process failed: " << e.what() << std::endl;
+        status = 1;
+    }
+    _exit(status);
+}
+
+/**
+ * @brief Run producer in this process and consumer in a forked child
+ */
+BenchmarkResults runCrossProcessBenchmark(const std::string& name, size_t num_ticks,
+                                          size_t capacity, bool huge_pages) {
+    std::cout << "\nRunning benchmark: " << name << " (" << num_ticks << " ticks)" << std::endl;
+
+    BenchmarkResults results{};
+    results.name = name;
+
+    const std::string shm_name = "/mdfh_bench_" + std::to_string(getpid());
+    auto queue = lockfree::ShmSPSCQueue<market::CompactTick>::create(shm_name, capacity, huge_pages);
+
+    // Every exit path closes whatever pipe ends are still open and unlinks the segment
+    int ready_pipe[2] = {-1, -1};
+    int report_pipe[2] = {-1, -1};
+    auto release = [&]() {
+        for (int fd : {ready_pipe[0], ready_pipe[1], report_pipe[0], report_pipe[1]}) {
+            if (fd >= 0) close(fd);
+        }
+        lockfree::ShmSPSCQueue<market::CompactTick>::unlink(shm_name);
+    };
+
+    if (pipe(ready_pipe) != 0 || pipe(report_pipe) != 0) {
+        std::cerr << "  pipe() failed" << std::endl;
+        release();
+        return results;
+    }
+
+    pid_t child = fork();
+    if (child < 0) {
+        std::cerr << "  fork() failed" << std::endl;
+        release();
+        return results;
+    }
+    if (child == 0) {
+        close(ready_pipe[0]);
+        close(report_pipe[0]);
+        runShmConsumerProcess(shm_name, num_ticks, ready_pipe[1], report_pipe[1]);
+    }
+    close(ready_pipe[1]);
+    close(report_pipe[1]);
+    ready_pipe[1] = report_pipe[1] = -1;
+
+    // Wait for the consumer to attach before timing starts (EOF if it died first)
+    int status = 0;
+    bool child_reaped = false;
+    char ready = 0;
+    if (readAll(ready_pipe[0], &ready, 1)) {
+        market::TickGenerator generator("SPY", 100.0, 0.01, 100, 1000);
+        size_t full_spins = 0;
+        for (size_t i = 0; i < num_ticks && !child_reaped; i++) {
+            market::CompactTick tick = market::CompactTick::fromMarketTick(generator.generateTick());
+            while (!queue->tryPush(tick)) {
+                // A full ring may mean the consumer died; check now and then instead of spinning forever
+                if (++full_spins % 1024 == 0 && waitpid(child, &status, WNOHANG) == child) {
+                    child_reaped = true;
+                    std::cerr << "  Consumer process exited with the ring full" << std::endl;
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    ShmConsumerReport report{};
+    bool ok = !child_reaped && readAll(report_pipe[0], &report, sizeof(report));
+    if (!child_reaped) waitpid(child, &status, 0);
+    release();
+
+    if (!ok || status != 0) {
+        std::cerr << "  Consumer process did not report results" << std::endl;
+        return results;
+    }
+
+    results.ticks_processed = report.ticks_processed;
+    results.throughput_tps = report.throughput_tps;
+    results.latency_mean = report.latency_mean;
+    results.latency_p50 = report.latency_p50;
+    results.latency_p99 = report.latency_p99;
+    results.latency_p999 = report.latency_p999;
+    results.latency_min = report.latency_min;
+    results.latency_max = report.latency_max;
+    results.elapsed_seconds = report.elapsed_seconds;
+
+    std::cout << "  Completed: " << results.ticks_processed << " ticks in "
+              << results.elapsed_seconds << " seconds" << std::endl;
+    std::cout << "  Throughput: " << static_cast<int>(results.throughput_tps) << " ticks/sec" << std::endl;
+    std::cout << "  Latency P99: " << results.latency_p99 << " μs" << std::endl;
+
+    return results;
+}
+
+} // namespace
+
+/**
+ * @brief Compare cross-process shared-memory SPSC against in-process SPSC
+ */
+void runSharedMemoryBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Shared-Memory SPSC - Cross-Process Benchmarks" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::vector<BenchmarkResults> all_results;
+    std::vector<size_t> test_sizes = {10000, 100000, 1000000};
+    const size_t ring_capacity = 65536;
+
+    for (size_t size : test_sizes) {
+        std::cout << "\n--- Testing with " << size << " ticks ---" << std::endl;
+
+        auto inproc_results = runBenchmark<lockfree::SPSCQueue<market::MarketTick>>(
+            "In-Process SPSC (" + std::to_string(size) + ")", size);
+        all_results.push_back(inproc_results);
+
+        auto shm_results = runCrossProcessBenchmark(
+            "Shared-Memory SPSC (" + std::to_string(size) + ")", size, ring_capacity, false);
+        all_results.push_back(shm_results);
+
+        auto shm_huge_results = runCrossProcessBenchmark(
+            "Shared-Memory SPSC HugePages (" + std::to_string(size) + ")", size, ring_capacity, true);
+        all_results.push_back(shm_huge_results);
+
+        if (shm_results.throughput_tps > 0.0) {
+            std::cout << "\n  Cross-process vs in-process throughput: " << std::fixed << std::setprecision(2)
+                      << (shm_results.throughput_tps / inproc_results.throughput_tps) << "x" << std::endl;
+            std::cout << "  Cross-process vs in-process P99: "
+                      << (shm_results.latency_p99 / inproc_results.latency_p99) << "x" << std::endl;
+        }
+    }
+
+    BenchmarkResults::exportToCSV(all_results, "shm_benchmark_results.csv");
+    std::cout << "\nResults exported to: shm_benchmark_results.csv" << std::endl;
+}
+
+} // namespace benchmark
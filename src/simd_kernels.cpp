@@ -0,0 +1,213 @@
+#include "simd_kernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#include <cstring>
+#define MARKET_SIMD_X86 1
+#endif
+
+namespace market {
+namespace simd {
+
+namespace {
+
+/**
+ * @brief Branchless scalar kernel; side masks are 0/1 multipliers
+ */
+BatchSums batchSumsScalar(const double* prices, const int32_t* volumes,
+                          const char* sides, size_t count) {
+    BatchSums s{0.0, 0, 0, 0, 0.0};
+    for (size_t i = 0; i < count; i++) {
+        int64_t vol = volumes[i];
+        s.price_volume += prices[i] * vol;
+        s.volume += vol;
+        s.buy_volume += vol * static_cast<int64_t>(sides[i] == 'B');
+        s.sell_volume += vol * static_cast<int64_t>(sides[i] == 'S');
+        s.price_sum += prices[i];
+    }
+    return s;
+}
+
+double sumScalar(const double* values, size_t count) {
+    double sum = 0.0;
+    for (size_t i = 0; i < count; i++) sum += values[i];
+    return sum;
+}
+
+#ifdef MARKET_SIMD_X86
+
+__attribute__((target("avx2")))
+double hsum256(__m256d v) {
+    __m128d lo = _mm256_castpd256_pd128(v);
+    __m128d hi = _mm256_extractf128_pd(v, 1);
+    lo = _mm_add_pd(lo, hi);
+    __m128d shuf = _mm_unpackhi_pd(lo, lo);
+    return _mm_cvtsd_f64(_mm_add_sd(lo, shuf));
+}
+
+__attribute__((target("avx2")))
+int64_t hsum256i(__m256i v) {
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), v);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+__attribute__((target("avx2")))
+BatchSums batchSumsAVX2(const double* prices, const int32_t* volumes,
+                        const char* sides, size_t count) {
+    __m256d pv_acc = _mm256_setzero_pd();
+    __m256d price_acc = _mm256_setzero_pd();
+    __m256i vol_acc = _mm256_setzero_si256();
+    __m256i buy_acc = _mm256_setzero_si256();
+    __m256i sell_acc = _mm256_setzero_si256();
+    const __m256i buy_code = _mm256_set1_epi64x('B');
+    const __m256i sell_code = _mm256_set1_epi64x('S');
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256d p = _mm256_loadu_pd(prices + i);
+        __m128i v32 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(volumes + i));
+        __m256d v = _mm256_cvtepi32_pd(v32);
+        __m256i v64 = _mm256_cvtepi32_epi64(v32);
+
+        int32_t side_bytes;
+        std::memcpy(&side_bytes, sides + i, sizeof(side_bytes));
+        __m256i s64 = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(side_bytes));
+
+        // All-ones lanes where the side matches, zero elsewhere
+        __m256i buy_mask = _mm256_cmpeq_epi64(s64, buy_code);
+        __m256i sell_mask = _mm256_cmpeq_epi64(s64, sell_code);
+
+        pv_acc = _mm256_add_pd(pv_acc, _mm256_mul_pd(p, v));
+        price_acc = _mm256_add_pd(price_acc, p);
+        vol_acc = _mm256_add_epi64(vol_acc, v64);
+        buy_acc = _mm256_add_epi64(buy_acc, _mm256_and_si256(v64, buy_mask));
+        sell_acc = _mm256_add_epi64(sell_acc, _mm256_and_si256(v64, sell_mask));
+    }
+
+    BatchSums s = batchSumsScalar(prices + i, volumes + i, sides + i, count - i);
+    s.price_volume += hsum256(pv_acc);
+    s.price_sum += hsum256(price_acc);
+    s.volume += hsum256i(vol_acc);
+    s.buy_volume += hsum256i(buy_acc);
+    s.sell_volume += hsum256i(sell_acc);
+    return s;
+}
+
+__attribute__((target("avx2")))
+double sumAVX2(const double* values, size_t count) {
+    __m256d acc = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        acc = _mm256_add_pd(acc, _mm256_loadu_pd(values + i));
+    }
+    return hsum256(acc) + sumScalar(values + i, count - i);
+}
+
+// GCC 12's AVX-512 intrinsic headers trip false -Wuninitialized positives
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+__attribute__((target("avx512f")))
+BatchSums batchSumsAVX512(const double* prices, const int32_t* volumes,
+                          const char* sides, size_t count) {
+    __m512d pv_acc = _mm512_setzero_pd();
+    __m512d price_acc = _mm512_setzero_pd();
+    __m512i vol_acc = _mm512_setzero_si512();
+    __m512i buy_acc = _mm512_setzero_si512();
+    __m512i sell_acc = _mm512_setzero_si512();
+    const __m512i buy_code = _mm512_set1_epi64('B');
+    const __m512i sell_code = _mm512_set1_epi64('S');
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m512d p = _mm512_loadu_pd(prices + i);
+        __m256i v32 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(volumes + i));
+        __m512d v = _mm512_cvtepi32_pd(v32);
+        __m512i v64 = _mm512_cvtepi32_epi64(v32);
+        __m512i s64 = _mm512_cvtepu8_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(sides + i)));
+
+        __mmask8 buy_mask = _mm512_cmpeq_epi64_mask(s64, buy_code);
+        __mmask8 sell_mask = _mm512_cmpeq_epi64_mask(s64, sell_code);
+
+        pv_acc = _mm512_add_pd(pv_acc, _mm512_mul_pd(p, v));
+        price_acc = _mm512_add_pd(price_acc, p);
+        vol_acc = _mm512_add_epi64(vol_acc, v64);
+        buy_acc = _mm512_mask_add_epi64(buy_acc, buy_mask, buy_acc, v64);
+        sell_acc = _mm512_mask_add_epi64(sell_acc, sell_mask, sell_acc, v64);
+    }
+
+    BatchSums s = batchSumsScalar(prices + i, volumes + i, sides + i, count - i);
+    s.price_volume += _mm512_reduce_add_pd(pv_acc);
+    s.price_sum += _mm512_reduce_add_pd(price_acc);
+    s.volume += _mm512_reduce_add_epi64(vol_acc);
+    s.buy_volume += _mm512_reduce_add_epi64(buy_acc);
+    s.sell_volume += _mm512_reduce_add_epi64(sell_acc);
+    return s;
+}
+
+__attribute__((target("avx512f")))
+double sumAVX512(const double* values, size_t count) {
+    __m512d acc = _mm512_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        acc = _mm512_add_pd(acc, _mm512_loadu_pd(values + i));
+    }
+    return _mm512_reduce_add_pd(acc) + sumScalar(values + i, count - i);
+}
+
+#pragma GCC diagnostic pop
+
+#endif // MARKET_SIMD_X86
+
+const KernelTable kScalarTable{KernelLevel::Scalar, "scalar", batchSumsScalar, sumScalar};
+#ifdef MARKET_SIMD_X86
+const KernelTable kAVX2Table{KernelLevel::AVX2, "avx2", batchSumsAVX2, sumAVX2};
+const KernelTable kAVX512Table{KernelLevel::AVX512, "avx512", batchSumsAVX512, sumAVX512};
+#endif
+
+const KernelTable& selectKernels() {
+    if (isSupported(KernelLevel::AVX512)) return kernelsFor(KernelLevel::AVX512);
+    if (isSupported(KernelLevel::AVX2)) return kernelsFor(KernelLevel::AVX2);
+    return kScalarTable;
+}
+
+} // namespace
+
+bool isSupported(KernelLevel level) {
+    switch (level) {
+        case KernelLevel::Scalar:
+            return true;
+#ifdef MARKET_SIMD_X86
+        case KernelLevel::AVX2:
+            return __builtin_cpu_supports("avx2");
+        case KernelLevel::AVX512:
+            return __builtin_cpu_supports("avx512f");
+#endif
+        default:
+            return false;
+    }
+}
+
+const KernelTable& kernelsFor(KernelLevel level) {
+    if (!isSupported(level)) return kScalarTable;
+    switch (level) {
+#ifdef MARKET_SIMD_X86
+        case KernelLevel::AVX2:
+            return kAVX2Table;
+        case KernelLevel::AVX512:
+            return kAVX512Table;
+#endif
+        default:
+            return kScalarTable;
+    }
+}
+
+const KernelTable& kernels() {
+    static const KernelTable& table = selectKernels();
+    return table;
+}
+
+} // namespace simd
+} // namespace market
@@ -0,0 +1,97 @@
+#include "benchmark.h"
+#include "market_simulator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+/**
+ * @brief Generate one scenario and summarise the resulting flow
+ */
+void runScenario(const market::SimulatorScenario& scenario, size_t n) {
+    market::MarketSimulator simulator(scenario);
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<market::MarketTick> ticks = simulator.generateTicks(n);
+    auto t1 = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+
+    // Symbol mix: share of the busiest symbol and the top 10
+    std::unordered_map<std::string, size_t> counts;
+    size_t buys = 0;
+    double volume_sum = 0.0;
+    for (const auto& tick : ticks) {
+        counts[tick.symbol]++;
+        if (tick.side == 'B') buys++;
+        volume_sum += tick.volume;
+    }
+    std::vector<size_t> sorted;
+    sorted.reserve(counts.size());
+    for (const auto& kv : counts) sorted.push_back(kv.second);
+    std::sort(sorted.begin(), sorted.end(), std::greater<size_t>());
+    size_t top10 = 0;
+    for (size_t i = 0; i < sorted.size() && i < 10; i++) top10 += sorted[i];
+
+    // Burstiness: coefficient of variation of inter-arrival gaps (1 = Poisson)
+    double gap_sum = 0.0;
+    double gap_sq_sum = 0.0;
+    for (size_t i = 1; i < ticks.size(); i++) {
+        double gap = static_cast<double>(ticks[i].timestamp_ns - ticks[i - 1].timestamp_ns);
+        gap_sum += gap;
+        gap_sq_sum += gap * gap;
+    }
+    double gap_mean = gap_sum / (ticks.size() - 1);
+    double gap_cv = std::sqrt(std::max(0.0, gap_sq_sum / (ticks.size() - 1) - gap_mean * gap_mean)) / gap_mean;
+
+    double sim_seconds = (ticks.back().timestamp_ns - ticks.front().timestamp_ns) / 1e9;
+
+    // Replaying the same seed must reproduce the same sequence
+    simulator.reset();
+    bool reproducible = true;
+    for (size_t i = 0; i < n && reproducible; i++) {
+        market::MarketTick tick = simulator.nextTick();
+        reproducible = tick.price == ticks[i].price && tick.volume == ticks[i].volume &&
+                       tick.timestamp_ns == ticks[i].timestamp_ns && tick.symbol == ticks[i].symbol;
+    }
+
+    std::cout << "\n--- Scenario '" << scenario.name << "' (" << scenario.num_symbols
+              << " symbols, seed " << scenario.seed << ") ---" << std::endl;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  Generation:        " << n / seconds / 1e6 << " M ticks/sec ("
+              << seconds * 1e9 / n << " ns/tick)" << std::endl;
+    std::cout << "  Simulated span:    " << std::setprecision(3) << sim_seconds << " s ("
+              << std::setprecision(0) << n / sim_seconds << " ticks/sec)" << std::endl;
+    std::cout << std::setprecision(1);
+    std::cout << "  Top symbol share:  " << 100.0 * sorted.front() / n << "%, top 10 "
+              << 100.0 * top10 / n << "%" << std::endl;
+    std::cout << std::setprecision(2);
+    std::cout << "  Inter-arrival CV:  " << gap_cv << " (1.00 = Poisson)" << std::endl;
+    std::cout << "  Buy ratio:         " << static_cast<double>(buys) / n
+              << ", mean volume " << std::setprecision(1) << volume_sum / n << std::endl;
+    std::cout << "  Seed replay:       " << (reproducible ? "identical" : "MISMATCH") << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Generate each simulator preset and report its flow characteristics
+ */
+void runSimulatorBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Market Simulator - Scenario Presets" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const size_t n = 1000000;
+    runScenario(market::SimulatorScenario::steady(), n);
+    runScenario(market::SimulatorScenario::openingBurst(), n);
+    runScenario(market::SimulatorScenario::skewedMomentum(), n);
+}
+
+} // namespace benchmark
@@ -0,0 +1,107 @@
+#include "benchmark.h"
+#include "analytics.h"
+#include "snapshot.h"
+#include "tick_generator.h"
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+struct ReaderStats {
+    uint64_t reads = 0;
+    uint64_t retries = 0;
+    uint64_t torn = 0;   // Snapshots failing the buy - sell == imbalance invariant
+};
+
+/**
+ * @brief One snapshot-publication run with a given number of reader threads
+ */
+void runSnapshotConfig(const std::vector<market::MarketTick>& ticks, size_t num_symbols,
+                       size_t num_readers, uint64_t publish_every_ticks) {
+    std::vector<market::AnalyticsEngine> engines(num_symbols);
+    market::SnapshotPublisher publisher(num_symbols, publish_every_ticks, 0);
+    std::atomic<bool> writer_done{false};
+    std::vector<ReaderStats> stats(num_readers);
+
+    std::vector<std::thread> readers;
+    for (size_t r = 0; r < num_readers; r++) {
+        readers.emplace_back([&, r]() {
+            std::mt19937 rng(static_cast<unsigned int>(r + 1));
+            ReaderStats local;
+            market::AnalyticsSnapshot snap;
+            while (!writer_done.load(std::memory_order_acquire)) {
+                size_t symbol = rng() % num_symbols;
+                if (publisher.tryRead(symbol, snap)) {
+                    local.reads++;
+                    if (snap.buy_volume - snap.sell_volume != snap.imbalance) local.torn++;
+                } else {
+                    local.retries++;
+                }
+            }
+            stats[r] = local;
+        });
+    }
+
+    size_t published = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ticks.size(); i++) {
+        size_t symbol = i % num_symbols;
+        engines[symbol].processTick(ticks[i]);
+        if (publisher.onTick(symbol, engines[symbol], ticks[i].timestamp_ns)) published++;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    writer_done.store(true, std::memory_order_release);
+    for (auto& t : readers) t.join();
+
+    ReaderStats total;
+    for (const auto& s : stats) {
+        total.reads += s.reads;
+        total.retries += s.retries;
+        total.torn += s.torn;
+    }
+
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+    std::cout << "  Readers " << std::setw(2) << num_readers
+              << " | writer " << std::fixed << std::setprecision(2)
+              << seconds * 1e9 / ticks.size() << " ns/tick, " << published << " publishes"
+              << " | reads " << static_cast<uint64_t>(total.reads / seconds) << "/s"
+              << ", retry " << std::setprecision(4)
+              << (total.reads + total.retries ? 100.0 * total.retries / (total.reads + total.retries) : 0.0)
+              << "%, torn " << total.torn << std::endl;
+}
+
+} // namespace
+
+/**
+ * @brief Measure seqlock snapshot publication with 1-16 reader threads
+ */
+void runSnapshotBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Analytics Snapshots - Seqlock Publication" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    const size_t n = 500000;
+    const size_t num_symbols = 64;
+    market::TickGenerator generator("SPY", 100.0, 0.01, 100, 1000, 42);
+    std::vector<market::MarketTick> ticks = generator.generateTicks(n);
+
+    const uint64_t publish_every[] = {1, 64};
+    const size_t reader_counts[] = {0, 1, 2, 4, 8, 16};
+
+    for (uint64_t k : publish_every) {
+        std::cout << "\n--- " << num_symbols << " symbols, publish every " << k << " tick(s) ---" << std::endl;
+        for (size_t readers : reader_counts) {
+            runSnapshotConfig(ticks, num_symbols, readers, k);
+        }
+    }
+}
+
+} // namespace benchmark
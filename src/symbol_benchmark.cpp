@@ -0,0 +1,146 @@
+#include "benchmark.h"
+#include "symbol_registry.h"
+#include "fast_rng.h"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kLookups = 1 << 20;
+constexpr size_t kBatch = 1024;
+
+/**
+ * @brief Symbol universe: mostly 1-5 letter tickers, every tenth a long option-style name
+ */
+std::vector<std::string> makeUniverse(size_t n) {
+    std::vector<std::string> symbols;
+    symbols.reserve(n);
+    for (size_t i = 0; i < n; i++) {
+        std::string ticker;
+        size_t v = i;
+        do {
+            ticker.push_back(static_cast<char>('A' + v % 26));
+            v /= 26;
+        } while (v > 0);
+        if (i % 10 == 9) {
+            ticker += "240621C" + std::to_string(100000 + i);    // > 8 bytes: hashed key
+        }
+        symbols.push_back(ticker);
+    }
+    return symbols;
+}
+
+struct LookupStats {
+    double mean_ns = 0.0;
+    double p99_ns = 0.0;
+};
+
+/**
+ * @brief Time lookups in batches; report ns/lookup mean and P99 over batches
+ */
+template<typename Query, typename LookupFn>
+LookupStats timeLookups(const std::vector<Query>& queries, LookupFn lookup) {
+    std::vector<double> batch_ns;
+    batch_ns.reserve(queries.size() / kBatch);
+    uint64_t sink = 0;
+    auto start = Clock::now();
+    for (size_t base = 0; base + kBatch <= queries.size(); base += kBatch) {
+        auto t0 = Clock::now();
+        for (size_t i = base; i < base + kBatch; i++) sink += lookup(queries[i]);
+        auto t1 = Clock::now();
+        batch_ns.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count() / kBatch);
+    }
+    double total_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    if (sink == 1) std::cout << sink;    // Keep the work observable
+
+    LookupStats stats;
+    stats.mean_ns = total_ns / (batch_ns.size() * kBatch);
+    std::sort(batch_ns.begin(), batch_ns.end());
+    stats.p99_ns = batch_ns[std::min(batch_ns.size() - 1, batch_ns.size() * 99 / 100)];
+    return stats;
+}
+
+void printRow(const std::string& label, const LookupStats& s) {
+    std::cout << "  " << std::left << std::setw(36) << label << std::right << std::fixed << std::setprecision(2)
+              << std::setw(10) << s.mean_ns << std::setw(12) << s.p99_ns << std::endl;
+}
+
+void runUniverse(size_t n) {
+    std::vector<std::string> universe = makeUniverse(n);
+
+    auto t0 = Clock::now();
+    market::SymbolRegistry registry(universe);
+    double build_ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+
+    std::unordered_map<std::string, market::SymbolId> map;
+    map.reserve(n);
+    for (size_t i = 0; i < n; i++) map.emplace(universe[i], static_cast<market::SymbolId>(i));
+
+    market::SymbolRegistry dynamic_only;
+    for (const auto& s : universe) dynamic_only.intern(s);
+
+    // Uniform random lookups: every symbol equally likely, so the tables do not all fit in L1
+    market::Xoshiro256PlusPlus rng(3);
+    std::vector<std::string> queries;
+    std::vector<uint64_t> packed;
+    queries.reserve(kLookups);
+    packed.reserve(kLookups);
+    for (size_t i = 0; i < kLookups; i++) {
+        const std::string& s = universe[rng.next() % n];
+        queries.push_back(s);
+        if (s.size() <= 8) packed.push_back(market::SymbolRegistry::encode(s));
+    }
+
+    // Sanity: every universe symbol maps to its list position
+    for (size_t i = 0; i < n; i++) {
+        if (registry.find(universe[i]) != i || dynamic_only.find(universe[i]) != i) {
+            std::cout << "  ERROR: lookup mismatch for " << universe[i] << std::endl;
+            return;
+        }
+    }
+
+    std::cout << "\n" << n << " symbols (" << n / 10 << " longer than 8 bytes): perfect hash built in "
+              << std::fixed << std::setprecision(2) << build_ms << " ms, "
+              << registry.getMemoryBytes() / 1024 << " KB, " << registry.spilledSize() << " spilled" << std::endl;
+    std::cout << "  " << std::left << std::setw(36) << "Lookup" << std::right
+              << std::setw(10) << "ns/op" << std::setw(12) << "P99 batch" << std::endl;
+
+    printRow("std::unordered_map<std::string>", timeLookups(queries, [&map](const std::string& s) {
+        return static_cast<uint64_t>(map.find(s)->second);
+    }));
+    printRow("SymbolRegistry::find (perfect hash)", timeLookups(queries, [&registry](const std::string& s) {
+        return static_cast<uint64_t>(registry.find(s));
+    }));
+    printRow("SymbolRegistry::findPacked (<= 8B)", timeLookups(packed, [&registry](uint64_t key) {
+        return static_cast<uint64_t>(registry.findPacked(key));
+    }));
+    printRow("dynamic table only (all interned)", timeLookups(queries, [&dynamic_only](const std::string& s) {
+        return static_cast<uint64_t>(dynamic_only.find(s));
+    }));
+}
+
+} // namespace
+
+/**
+ * @brief Symbol lookup latency: perfect-hash registry vs dynamic table vs std::unordered_map
+ */
+void runSymbolBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Symbol Registry - Lookup Latency" << std::endl;
+    std::cout << "========================================" << std::endl;
+    std::cout << kLookups << " uniformly random lookups per table, timed in batches of " << kBatch << std::endl;
+
+    const size_t sizes[] = {1000, 10000, 100000, 1000000, 4000000};
+    for (size_t n : sizes) runUniverse(n);
+}
+
+} // namespace benchmark
@@ -0,0 +1,166 @@
+#include "symbol_registry.h"
+#include <algorithm>
+#include <unordered_map>
+
+namespace market {
+
+namespace {
+
+// A bucket that finds no displacement within this many tries forces a reseed
+constexpr uint32_t kMaxDisplacement = 1u << 16;
+
+// Average keys per bucket: fewer means a faster build and a larger table
+constexpr size_t kKeysPerBucket = 3;
+
+// Slots per key: a few spare slots keep the last buckets from running out of room
+constexpr double kSlotsPerKey = 1.0 / 0.99;
+
+// Seeds tried before unplaceable buckets are spilled to the spill table
+constexpr int kMaxSeeds = 4;
+
+} // namespace
+
+SymbolRegistry::SymbolRegistry(const std::vector<std::string>& universe)
+    : seed_(0x243f6a8885a308d3ULL), bucket_count_(0), static_count_(0), dynamic_count_(0) {
+    std::unordered_map<uint64_t, SymbolId> seen;
+    std::vector<uint64_t> keys;
+    std::vector<std::string> collisions;    // Distinct long symbols with equal hashes
+    seen.reserve(universe.size());
+    keys.reserve(universe.size());
+    universe_names_.reserve(universe.size());
+
+    for (const auto& symbol : universe) {
+        uint64_t key = encode(symbol);
+        auto it = seen.find(key);
+        if (it != seen.end()) {
+            if (universe_names_[it->second] != symbol) collisions.push_back(symbol);
+            continue;
+        }
+        seen.emplace(key, static_cast<SymbolId>(universe_names_.size()));
+        universe_names_.push_back(symbol);
+        keys.push_back(key);
+    }
+
+    build(keys);
+    for (const auto& symbol : collisions) intern(symbol);
+}
+
+std::vector<uint32_t> SymbolRegistry::place(const std::vector<uint64_t>& keys, bool spill) {
+    const size_t slot_count = static_keys_.size();
+    std::vector<std::vector<uint32_t>> buckets(bucket_count_);
+    for (size_t i = 0; i < keys.size(); i++) buckets[bucketOf(keys[i])].push_back(static_cast<uint32_t>(i));
+
+    // Largest buckets first, while most slots are still free
+    std::vector<size_t> order(bucket_count_);
+    for (size_t b = 0; b < bucket_count_; b++) order[b] = b;
+    std::stable_sort(order.begin(), order.end(),
+                     [&buckets](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+    std::fill(static_keys_.begin(), static_keys_.end(), 0);
+    std::fill(static_ids_.begin(), static_ids_.end(), kInvalidSymbolId);
+    std::fill(displacements_.begin(), displacements_.end(), 0);
+    std::vector<bool> taken(slot_count, false);
+    std::vector<size_t> slots;
+    std::vector<uint32_t> spilled;
+
+    for (size_t b : order) {
+        const std::vector<uint32_t>& bucket = buckets[b];
+        if (bucket.empty()) break;
+
+        bool placed = false;
+        for (uint32_t d = 0; d < kMaxDisplacement && !placed; d++) {
+            slots.clear();
+            bool fits = true;
+            for (uint32_t i : bucket) {
+                size_t slot = slotOf(keys[i], d);
+                if (taken[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) {
+                    fits = false;
+                    break;
+                }
+                slots.push_back(slot);
+            }
+            if (!fits) continue;
+
+            for (size_t k = 0; k < bucket.size(); k++) {
+                taken[slots[k]] = true;
+                static_keys_[slots[k]] = keys[bucket[k]];
+                static_ids_[slots[k]] = bucket[k];
+            }
+            displacements_[b] = d;
+            placed = true;
+        }
+        if (!placed) {
+            spilled.insert(spilled.end(), bucket.begin(), bucket.end());
+            if (!spill) return spilled;
+        }
+    }
+    return spilled;
+}
+
+void SymbolRegistry::build(const std::vector<uint64_t>& keys) {
+    const size_t n = keys.size();
+    if (n == 0) return;
+    bucket_count_ = n / kKeysPerBucket + 1;
+    static_keys_.assign(static_cast<size_t>(n * kSlotsPerKey) + 1, 0);
+    static_ids_.assign(static_keys_.size(), kInvalidSymbolId);
+    displacements_.assign(bucket_count_, 0);
+
+    // A few reseeds almost always place everything; the last attempt spills
+    // whatever still does not fit, so the build time stays bounded
+    for (int attempt = 1; ; attempt++) {
+        bool last = attempt == kMaxSeeds;
+        std::vector<uint32_t> spilled = place(keys, last);
+        if (spilled.empty() || last) {
+            static_count_ = n - spilled.size();
+            if (spilled.empty()) return;
+            // Half-empty, like the dynamic table, and never resized afterwards
+            size_t capacity = 16;
+            while (capacity < spilled.size() * 2) capacity *= 2;
+            spilled_.assign(capacity, DynamicSlot{0, kInvalidSymbolId});
+            for (uint32_t i : spilled) {
+                size_t slot = mix(keys[i]) & (capacity - 1);
+                while (spilled_[slot].key != 0) slot = (slot + 1) & (capacity - 1);
+                spilled_[slot] = DynamicSlot{keys[i], i};
+            }
+            return;
+        }
+        seed_ = mix(seed_ + 1);
+    }
+}
+
+SymbolId SymbolRegistry::findIn(const std::vector<DynamicSlot>& table, uint64_t key, std::string_view symbol) const {
+    const size_t mask = table.size() - 1;
+    for (size_t i = mix(key) & mask; table[i].key != 0; i = (i + 1) & mask) {
+        if (table[i].key == key && sameSymbol(key, table[i].id, symbol)) return table[i].id;
+    }
+    return kInvalidSymbolId;
+}
+
+void SymbolRegistry::insertDynamic(uint64_t key, SymbolId id) {
+    // Keep the load factor at or below 1/2
+    if ((dynamic_count_ + 1) * 2 > dynamic_.size()) {
+        std::vector<DynamicSlot> old;
+        old.swap(dynamic_);
+        dynamic_.assign(old.empty() ? 16 : old.size() * 2, DynamicSlot{0, kInvalidSymbolId});
+        dynamic_count_ = 0;
+        for (const auto& slot : old) {
+            if (slot.key != 0) insertDynamic(slot.key, slot.id);
+        }
+    }
+    const size_t mask = dynamic_.size() - 1;
+    size_t i = mix(key) & mask;
+    while (dynamic_[i].key != 0) i = (i + 1) & mask;
+    dynamic_[i] = DynamicSlot{key, id};
+    dynamic_count_++;
+}
+
+SymbolId SymbolRegistry::intern(std::string_view symbol) {
+    SymbolId id = find(symbol);
+    if (id != kInvalidSymbolId) return id;
+    id = static_cast<SymbolId>(size());
+    dynamic_names_.emplace_back(symbol);
+    insertDynamic(encode(symbol), id);
+    return id;
+}
+
+} // namespace market
@@ -0,0 +1,233 @@
+#include "telemetry.h"
+#include "market_tick.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace market {
+
+double TelemetrySnapshot::windowPercentileNanos(const TelemetrySnapshot& earlier, double percentile) const {
+    uint64_t window[TelemetrySlot::kLatencyBuckets];
+    uint64_t total = 0;
+    for (int i = 0; i < TelemetrySlot::kLatencyBuckets; i++) {
+        window[i] = latency_ns[i] - earlier.latency_ns[i];
+        total += window[i];
+    }
+    if (total == 0) return std::numeric_limits<double>::quiet_NaN();
+
+    uint64_t rank = static_cast<uint64_t>(percentile * total);
+    if (rank >= total) rank = total - 1;
+    uint64_t seen = 0;
+    for (int i = 0; i < TelemetrySlot::kLatencyBuckets; i++) {
+        seen += window[i];
+        if (seen > rank) {
+            // Upper edge of the bucket: conservative for tail latency
+            return static_cast<double>(i + 1 < TelemetrySlot::kLatencyBuckets
+                                       ? TelemetrySlot::latencyBucketLow(i + 1)
+                                       : TelemetrySlot::latencyBucketLow(i));
+        }
+    }
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+TelemetrySlot* TelemetryRegistry::acquire() {
+    for (auto& slot : slots_) {
+        bool expected = false;
+        if (slot.in_use_.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void TelemetryRegistry::release(TelemetrySlot* slot) {
+    if (slot) slot->in_use_.store(false, std::memory_order_release);
+}
+
+TelemetrySnapshot TelemetryRegistry::snapshot() const {
+    TelemetrySnapshot s;
+    s.timestamp_ns = getCurrentTimeNanos();
+    for (const auto& slot : slots_) {
+        if (slot.in_use_.load(std::memory_order_relaxed)) s.active_threads++;
+        s.produced += slot.produced_.load(std::memory_order_relaxed);
+        s.consumed += slot.consumed_.load(std::memory_order_relaxed);
+        s.notional += slot.notional_.load(std::memory_order_relaxed);
+        s.volume += slot.volume_.load(std::memory_order_relaxed);
+        for (int i = 0; i < TelemetrySlot::kLatencyBuckets; i++) {
+            s.latency_ns[i] += slot.latency_ns_[i].load(std::memory_order_relaxed);
+        }
+    }
+    return s;
+}
+
+namespace {
+
+void writeMetric(std::ostringstream& out, const char* name, const char* type, const char* help, double value) {
+    out << "# HELP " << name << " " << help << "\n"
+        << "# TYPE " << name << " " << type << "\n"
+        << name << " ";
+    if (std::isnan(value)) {
+        out << "NaN";
+    } else {
+        out << value;
+    }
+    out << "\n";
+}
+
+} // namespace
+
+std::string renderPrometheus(const TelemetrySnapshot& current, const TelemetrySnapshot& previous) {
+    std::ostringstream out;
+    out.precision(12);
+    double seconds = (current.timestamp_ns - previous.timestamp_ns) / 1e9;
+    double rate = seconds > 0.0 ? (current.consumed - previous.consumed) / seconds : 0.0;
+    // Slots are summed one at a time, not atomically, so the difference can dip below zero
+    double depth = current.produced > current.consumed
+        ? static_cast<double>(current.produced - current.consumed) : 0.0;
+    double vwap = current.volume > 0.0 ? current.notional / current.volume
+                                       : std::numeric_limits<double>::quiet_NaN();
+
+    writeMetric(out, "mdfh_ticks_produced_total", "counter", "Ticks pushed by producers",
+                static_cast<double>(current.produced));
+    writeMetric(out, "mdfh_ticks_consumed_total", "counter", "Ticks processed by consumers",
+                static_cast<double>(current.consumed));
+    writeMetric(out, "mdfh_ticks_per_second", "gauge", "Consumed ticks per second over the last interval", rate);
+    writeMetric(out, "mdfh_queue_depth", "gauge", "Ticks produced but not yet consumed", depth);
+    writeMetric(out, "mdfh_latency_p50_microseconds", "gauge",
+                "Median tick latency over the last interval (bucket upper edge)",
+                current.windowPercentileNanos(previous, 0.50) / 1000.0);
+    writeMetric(out, "mdfh_latency_p99_microseconds", "gauge",
+                "P99 tick latency over the last interval (bucket upper edge)",
+                current.windowPercentileNanos(previous, 0.99) / 1000.0);
+    writeMetric(out, "mdfh_vwap", "gauge", "Volume-weighted average price of all consumed ticks", vwap);
+    writeMetric(out, "mdfh_telemetry_threads", "gauge", "Pipeline threads currently reporting",
+                static_cast<double>(current.active_threads));
+    return out.str();
+}
+
+TelemetryExporter::TelemetryExporter(TelemetryRegistry& registry, const TelemetryConfig& config)
+    : registry_(registry), config_(config), running_(false), listen_fd_(-1), publications_(0) {}
+
+TelemetryExporter::~TelemetryExporter() { stop(); }
+
+bool TelemetryExporter::start() {
+    if (running_.load()) return true;
+
+    if (!config_.socket_path.empty()) {
+        sockaddr_un addr;
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (config_.socket_path.size() >= sizeof(addr.sun_path)) {
+            error_ = "socket path too long: " + config_.socket_path;
+            return false;
+        }
+        std::strncpy(addr.sun_path, config_.socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+        listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC | SOCK_NONBLOCK, 0);
+        if (listen_fd_ < 0) {
+            error_ = std::string("socket: ") + std::strerror(errno);
+            return false;
+        }
+        ::unlink(config_.socket_path.c_str());
+        if (bind(listen_fd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+            listen(listen_fd_, 8) != 0) {
+            error_ = "bind(" + config_.socket_path + "): " + std::strerror(errno);
+            ::close(listen_fd_);
+            listen_fd_ = -1;
+            return false;
+        }
+    }
+
+    running_.store(true);
+    thread_ = std::thread(&TelemetryExporter::run, this);
+    return true;
+}
+
+void TelemetryExporter::stop() {
+    if (!running_.exchange(false)) return;
+    if (thread_.joinable()) thread_.join();
+    if (listen_fd_ >= 0) {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+        ::unlink(config_.socket_path.c_str());
+    }
+}
+
+std::string TelemetryExporter::latest() const {
+    std::lock_guard<std::mutex> lock(text_mutex_);
+    return latest_;
+}
+
+void TelemetryExporter::publish(TelemetrySnapshot& previous) {
+    TelemetrySnapshot current = registry_.snapshot();
+    std::string text = renderPrometheus(current, previous);
+    previous = current;
+
+    if (!config_.file_path.empty()) {
+        std::string tmp = config_.file_path + ".tmp";
+        {
+            std::ofstream file(tmp, std::ios::trunc);
+            file << text;
+        }
+        std::rename(tmp.c_str(), config_.file_path.c_str());
+    }
+
+    std::lock_guard<std::mutex> lock(text_mutex_);
+    latest_ = std::move(text);
+    publications_++;
+}
+
+void TelemetryExporter::serveClients(int timeout_ms) {
+    if (listen_fd_ < 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout_ms));
+        return;
+    }
+    pollfd pfd{listen_fd_, POLLIN, 0};
+    if (poll(&pfd, 1, timeout_ms) <= 0) return;
+
+    while (true) {
+        int client = accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (client < 0) break;
+        std::string text = latest();
+        const char* data = text.data();
+        size_t left = text.size();
+        while (left > 0) {
+            ssize_t n = ::send(client, data, left, MSG_NOSIGNAL);
+            if (n <= 0) break;
+            data += n;
+            left -= static_cast<size_t>(n);
+        }
+        ::close(client);
+    }
+}
+
+void TelemetryExporter::run() {
+    TelemetrySnapshot previous = registry_.snapshot();
+    publish(previous);
+    auto next = std::chrono::steady_clock::now() + config_.interval;
+
+    while (running_.load(std::memory_order_acquire)) {
+        auto now = std::chrono::steady_clock::now();
+        if (now >= next) {
+            publish(previous);
+            next += config_.interval;
+            if (next < now) next = now + config_.interval;
+            continue;
+        }
+        // Wake at least every 50 ms so stop() is prompt
+        auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(next - now).count();
+        serveClients(static_cast<int>(std::min<long long>(wait + 1, 50)));
+    }
+    publish(previous);
+}
+
+} // namespace market
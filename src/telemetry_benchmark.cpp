@@ -0,0 +1,99 @@
+#include "benchmark.h"
+#include "benchmark_runner.h"
+#include "benchmark_report.h"
+#include "telemetry.h"
+#include "lockfree_queue.h"
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace benchmark {
+
+namespace {
+
+/**
+ * @brief Nanoseconds per call of the producer- and consumer-side slot updates
+ */
+void measureSlotCost(size_t iterations) {
+    market::TelemetryRegistry registry;
+    market::TelemetrySlot* slot = registry.acquire();
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) slot->addProduced();
+    auto t1 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; i++) {
+        slot->recordTick(500 + (i & 4095), 100.0 + (i & 15) * 0.01, 100 + static_cast<int>(i & 255));
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    registry.release(slot);
+
+    double produced_ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+    double consumed_ns = std::chrono::duration<double, std::nano>(t2 - t1).count() / iterations;
+    std::cout << "  addProduced():  " << std::fixed << std::setprecision(2) << produced_ns << " ns/call" << std::endl;
+    std::cout << "  recordTick():   " << consumed_ns << " ns/call" << std::endl;
+}
+
+BenchmarkSummary measurePipeline(const std::string& label, size_t num_ticks, const RunOptions& options,
+                                 size_t repetitions) {
+    runConfiguredBenchmark<lockfree::SPSCQueue<market::MarketTick>>(label, num_ticks, options);
+    std::vector<BenchmarkResults> runs;
+    for (size_t r = 0; r < repetitions; r++) {
+        runs.push_back(runConfiguredBenchmark<lockfree::SPSCQueue<market::MarketTick>>(label, num_ticks, options));
+    }
+    return BenchmarkSummary::fromRuns("lockfree", num_ticks, runs);
+}
+
+} // namespace
+
+/**
+ * @brief Measure live-telemetry overhead on the hot path and show a scrape
+ */
+void runTelemetryBenchmarks() {
+    std::cout << "\n========================================" << std::endl;
+    std::cout << "Runtime Telemetry - Hot-Path Overhead" << std::endl;
+    std::cout << "========================================" << std::endl;
+
+    std::cout << "\nPer-thread slot update cost (10M calls):" << std::endl;
+    measureSlotCost(10000000);
+
+    const size_t num_ticks = 500000;
+    const size_t repetitions = 5;
+    const std::string prom_path = "telemetry.prom";
+
+    RunOptions options;
+    BenchmarkSummary off = measurePipeline("telemetry off", num_ticks, options, repetitions);
+
+    market::TelemetryRegistry registry;
+    market::TelemetryConfig config;
+    config.file_path = prom_path;
+    config.interval = std::chrono::milliseconds(100);
+    market::TelemetryExporter exporter(registry, config);
+    exporter.start();
+    options.telemetry = &registry;
+    BenchmarkSummary on = measurePipeline("telemetry on", num_ticks, options, repetitions);
+    exporter.stop();
+
+    std::cout << "\nLock-free SPSC, " << num_ticks << " ticks, median of " << repetitions
+              << " runs (exporter every " << config.interval.count() << " ms)" << std::endl;
+    std::cout << "  " << std::left << std::setw(16) << "Config" << std::right
+              << std::setw(14) << "Ticks/s" << std::setw(14) << "P99 (μs)" << std::endl;
+    for (const BenchmarkSummary* s : {&off, &on}) {
+        std::cout << "  " << std::left << std::setw(16) << (s == &off ? "telemetry off" : "telemetry on")
+                  << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(14) << s->throughput_tps.median
+                  << std::setprecision(2) << std::setw(13) << s->latency_p99.median << std::endl;
+    }
+    if (off.throughput_tps.median > 0.0) {
+        double overhead = 100.0 * (off.throughput_tps.median - on.throughput_tps.median) / off.throughput_tps.median;
+        std::cout << "  Throughput overhead: " << std::setprecision(1) << overhead << "% ("
+                  << exporter.getPublications() << " publications)" << std::endl;
+    }
+
+    std::cout << "\nLast exposition (" << prom_path << "):\n" << exporter.latest();
+    std::remove(prom_path.c_str());
+}
+
+} // namespace benchmark
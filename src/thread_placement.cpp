@@ -0,0 +1,152 @@
+#include "thread_placement.h"
+#include <linux/mempolicy.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+
+namespace benchmark {
+
+namespace {
+
+int readSysfsInt(const std::string& path) {
+    std::ifstream file(path);
+    int value = -1;
+    if (file >> value) return value;
+    return -1;
+}
+
+int numaNodeOf(int cpu) {
+    // cpuN/ contains a "nodeM" link on NUMA-enabled kernels
+    std::string dir = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+    DIR* d = opendir(dir.c_str());
+    if (!d) return -1;
+    int node = -1;
+    while (dirent* entry = readdir(d)) {
+        if (std::strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9') {
+            node = std::atoi(entry->d_name + 4);
+            break;
+        }
+    }
+    closedir(d);
+    return node;
+}
+
+constexpr size_t kMaxNodes = 1024;
+constexpr size_t kMaskBits = sizeof(unsigned long) * 8;
+
+bool makeNodeMask(int node, unsigned long (&mask)[kMaxNodes / kMaskBits]) {
+    if (node < 0 || static_cast<size_t>(node) >= kMaxNodes) return false;
+    std::memset(mask, 0, sizeof(mask));
+    mask[node / kMaskBits] = 1UL << (node % kMaskBits);
+    return true;
+}
+
+} // namespace
+
+bool setRealtimePriority(int priority) {
+    if (priority <= 0) return true;
+    sched_param param{};
+    param.sched_priority = priority;
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+}
+
+bool preferMemoryNode(int node) {
+    if (node < 0) return true;
+    unsigned long mask[kMaxNodes / kMaskBits];
+    if (!makeNodeMask(node, mask)) return false;
+    return syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask, kMaxNodes) == 0;
+}
+
+bool bindMemoryToNode(void* addr, size_t length, int node) {
+    if (node < 0) return true;
+    unsigned long mask[kMaxNodes / kMaskBits];
+    if (!makeNodeMask(node, mask)) return false;
+    return syscall(SYS_mbind, addr, length, MPOL_BIND, mask, kMaxNodes, MPOL_MF_MOVE) == 0;
+}
+
+CpuTopology CpuTopology::discover() {
+    CpuTopology topology;
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) return topology;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (!CPU_ISSET(cpu, &allowed)) continue;
+        std::string base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/";
+        CpuInfo info;
+        info.cpu = cpu;
+        info.core_id = readSysfsInt(base + "core_id");
+        info.package_id = readSysfsInt(base + "physical_package_id");
+        info.numa_node = numaNodeOf(cpu);
+        topology.cpus_.push_back(info);
+    }
+    return topology;
+}
+
+const CpuInfo* CpuTopology::find(int cpu) const {
+    for (const auto& info : cpus_) {
+        if (info.cpu == cpu) return &info;
+    }
+    return nullptr;
+}
+
+bool CpuTopology::findSiblingPair(int& first, int& second) const {
+    for (size_t i = 0; i < cpus_.size(); i++) {
+        for (size_t j = i + 1; j < cpus_.size(); j++) {
+            if (cpus_[i].package_id == cpus_[j].package_id && cpus_[i].core_id == cpus_[j].core_id) {
+                first = cpus_[i].cpu;
+                second = cpus_[j].cpu;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool CpuTopology::findSameSocketPair(int& first, int& second) const {
+    for (size_t i = 0; i < cpus_.size(); i++) {
+        for (size_t j = i + 1; j < cpus_.size(); j++) {
+            if (cpus_[i].package_id == cpus_[j].package_id && cpus_[i].core_id != cpus_[j].core_id) {
+                first = cpus_[i].cpu;
+                second = cpus_[j].cpu;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool CpuTopology::findCrossSocketPair(int& first, int& second) const {
+    for (size_t i = 0; i < cpus_.size(); i++) {
+        for (size_t j = i + 1; j < cpus_.size(); j++) {
+            if (cpus_[i].package_id != cpus_[j].package_id) {
+                first = cpus_[i].cpu;
+                second = cpus_[j].cpu;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+size_t CpuTopology::getPackageCount() const {
+    std::set<int> packages;
+    for (const auto& info : cpus_) packages.insert(info.package_id);
+    return packages.size();
+}
+
+std::string CpuTopology::describe() const {
+    std::ostringstream out;
+    for (const auto& info : cpus_) {
+        out << "  cpu " << info.cpu << ": core " << info.core_id << ", package " << info.package_id
+            << ", node " << info.numa_node << "\n";
+    }
+    return out.str();
+}
+
+} // namespace benchmark
@@ -16,7 +16,10 @@ TickGenerator::TickGenerator(const std::string& symbol,
       rng_(seed == 0 ? std::random_device{}() : seed),
       price_dist_(-1.0, 1.0),
       volume_dist_(min_volume, max_volume),
-      side_dist_(0, 1)
+      side_dist_(0, 1),
+      fast_rng_(seed == 0 ? std::random_device{}() : seed),
+      batch_rng_(seed == 0 ? std::random_device{}() : seed + 0x9E3779B97F4A7C15ULL),
+      volume_range_(static_cast<uint32_t>(max_volume - min_volume + 1))
 {
 }
 
@@ -53,6 +56,54 @@ std::vector<MarketTick> TickGenerator::generateTicks(size_t count) {
     return ticks;
 }
 
+MarketTick TickGenerator::generateTickFast(uint64_t timestamp_ns) {
+    double step;
+    int32_t volume;
+    char side;
+    decodeDraw(fast_rng_.next(), step, volume, side);
+    
+    current_price_ += step;
+    current_price_ = current_price_ < 0.01 ? 0.01 : current_price_;
+    
+    uint64_t timestamp = timestamp_ns != 0 ? timestamp_ns : getCurrentTimeNanos();
+    return MarketTick(symbol_, current_price_, volume, side, timestamp);
+}
+
+void TickGenerator::generateBatch(TickBatch& batch, size_t count, bool single_timestamp) {
+    batch.resize(count);
+    double* prices = batch.prices();
+    int32_t* volumes = batch.volumes();
+    char* sides = batch.sides();
+    uint64_t* timestamps = batch.timestamps();
+    
+    // Random draws and decoding: independent per tick, vectorisable
+    constexpr size_t lanes = Xoshiro256PlusPlusLanes<8>::kLanes;
+    alignas(64) uint64_t draws[lanes];
+    for (size_t i = 0; i < count; i += lanes) {
+        batch_rng_.next(draws);
+        size_t n = count - i < lanes ? count - i : lanes;
+        for (size_t j = 0; j < n; j++) {
+            decodeDraw(draws[j], prices[i + j], volumes[i + j], sides[i + j]);
+        }
+    }
+    
+    // Random walk: prefix sum of the steps, floored at one cent
+    double price = current_price_;
+    for (size_t i = 0; i < count; i++) {
+        price += prices[i];
+        price = price < 0.01 ? 0.01 : price;
+        prices[i] = price;
+    }
+    current_price_ = price;
+    
+    if (single_timestamp) {
+        uint64_t timestamp = getCurrentTimeNanos();
+        for (size_t i = 0; i < count; i++) timestamps[i] = timestamp;
+    } else {
+        for (size_t i = 0; i < count; i++) timestamps[i] = getCurrentTimeNanos();
+    }
+}
+
 void TickGenerator::resetPrice(double base_price) {
     current_price_ = base_price;
 }